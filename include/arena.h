@@ -0,0 +1,47 @@
+/**
+ * @brief It defines the arena where the entities of a game are allocated
+ *
+ * @file arena.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+/**
+ * @brief Region of memory the entities are carved from one after the other, and that is released all at once
+ * @author agent
+ */
+typedef struct _Arena Arena;
+
+/**
+ * @brief Creates an empty arena
+ * @author agent
+ * @return a pointer to the new arena, or NULL in case of error
+ */
+Arena *arena_create();
+
+/**
+ * @brief Frees an arena and all the memory allocated from it
+ * @author agent
+ * @param arena the arena
+ */
+void arena_destroy(Arena *arena);
+
+/**
+ * @brief Allocates memory from an arena
+ * @author agent
+ *
+ * The memory is filled with zeros and aligned for any type. It cannot be freed on its own, it lasts until the arena is destroyed.
+ * @param arena the arena
+ * @param size the number of bytes
+ * @return a pointer to the memory, or NULL in case of error
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+#endif
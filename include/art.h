@@ -0,0 +1,66 @@
+/**
+ * @brief It defines the store of graphic descriptions shared between spaces
+ *
+ * @file art.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ART_H
+#define ART_H
+
+#include "types.h"
+
+/**
+ * @brief Graphic description made of rows of text, which never changes once it is in the store
+ * @author agent
+ *
+ * Equal descriptions are stored once and counted by reference, whichever space or game they belong to.
+ * The store and the references are guarded by a lock, so games in different threads can share the same arts. The rows never change, so they are read without it.
+ */
+typedef struct _Art Art;
+
+/**
+ * @brief Gets a reference to the art with the given rows, adding a copy of them to the store if they are not there yet
+ * @author agent
+ * @param rows the rows of the art, a NULL row is taken as an empty one
+ * @param n_rows the number of rows
+ * @param row_size the size of the buffer each row used to have, longer rows are cut to row_size - 1 characters
+ * @return a pointer to the art, or NULL in case of error. It must be released with art_release
+ */
+Art *art_acquire(char **rows, int n_rows, int row_size);
+
+/**
+ * @brief Gets another reference to an art
+ * @author agent
+ * @param art the art
+ * @return the same art, which must be released once more with art_release
+ */
+Art *art_retain(Art *art);
+
+/**
+ * @brief Drops a reference to an art, freeing it when it was the last one
+ * @author agent
+ * @param art the art
+ */
+void art_release(Art *art);
+
+/**
+ * @brief Gets the rows of an art, which must not be modified
+ * @author agent
+ * @param art the art
+ * @return the rows, NULL if the art is NULL
+ */
+char **art_get_rows(Art *art);
+
+/**
+ * @brief Gets the number of references to an art
+ * @author agent
+ * @param art the art
+ * @return the number of references, -1 if the art is NULL
+ */
+int art_get_refs(Art *art);
+
+#endif
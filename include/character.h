@@ -12,6 +12,7 @@
 #define CHARACTER_H
 
 #include "types.h"
+#include "arena.h"
 
 #define GDESCTAM 17          /*!<Maximum size of the graphic description*/
 #define MAXHEALTH 100       /*!<Maximum health a character can have*/
@@ -42,6 +43,27 @@ typedef struct _Character Character;
  */
 Character *character_create(Id id);
 
+/**
+ * @brief Creates a new character in an arena.
+ * @author agent
+ *
+ * @param arena The arena the character is allocated from, or NULL to allocate it on its own like character_create.
+ * @param id The identifier for the new character.
+ * @return A pointer to the new created Character structure, which character_destroy does not free if it is in an arena, or NULL if memory allocation fails.
+ */
+Character *character_create_in_arena(Arena *arena, Id id);
+
+/**
+ * @brief Creates a copy of a character in an arena, with the same health, location and turn of messages.
+ * @author agent
+ *
+ * The name and the messages are shared with the copy.
+ * @param arena The arena the copy is allocated from, or NULL to allocate it on its own.
+ * @param c A pointer to the character to copy.
+ * @return A pointer to the copy, or NULL if memory allocation fails.
+ */
+Character *character_copy_in_arena(Arena *arena, Character *c);
+
 /**
  * @brief Destroys the character.
  * @author Alvaro Inigo
@@ -72,7 +94,7 @@ Status character_set_name(Character *c, char *name);
  * @brief Sets a new graphic description for the character.
  * @author Alvaro Inigo
  * @param c a pointer to character
- * @param desc the graphic description, a pointer to char
+ * @param desc the graphic description, a pointer to char (\xHH escape sequences are decoded to UTF-8)
  * @return Status Ok if everything went fine or ERROR
  */
 Status character_set_gdesc(Character *c, char *desc);
@@ -81,7 +103,7 @@ Status character_set_gdesc(Character *c, char *desc);
  * @brief Sets a new graphic description for the character when they are dead.
  * @author Alvaro Inigo
  * @param c a pointer to character
- * @param desc the graphic description when they are dead
+ * @param desc the graphic description when they are dead (\xHH escape sequences are decoded to UTF-8)
  * @return Status Ok if everything went fine or ERROR
  */
 Status character_set_dead_gdesc(Character *c, char *desc);
@@ -234,6 +256,15 @@ int character_get_n_messages(Character *character);
  */
 int character_get_message_turn(Character *character);
 
+/**
+ * @brief sets the turn of the next message the character says
+ * @author agent
+ * @param character a pointer to the character
+ * @param turn the position of the next message, 0 if the character has no messages
+ * @return Status OK or ERROR
+ */
+Status character_set_message_turn(Character *character, int turn);
+
 /**
  * @brief returns the message of the character and sets the turn to the next one
  * @author Alvaro Inigo
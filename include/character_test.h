@@ -353,4 +353,54 @@ void test01_character_chat();
  * @post char* the messages of the character
  */
 void test02_character_chat();
-#endif
\ No newline at end of file
+
+/**
+ * @brief tests that escaped graphic descriptions are decoded when they are set
+ * @pre a valid pointer to character with an escaped emoticon and an escaped symbol as graphic descriptions
+ * @post the graphic descriptions hold the UTF-8 bytes
+ */
+void test03_character_set_dead_gdesc();
+
+/**
+ * @test Test character creation in an arena
+ * @pre An arena and a character ID
+ * @post Non NULL pointer to character and character_destroy returns OK, the memory is released with the arena
+ */
+void test01_character_create_in_arena();
+
+/**
+ * @test Test that the name is copied and that equal names share their text
+ * @pre Two characters, the first named from a buffer that is then overwritten, the second given the same name
+ * @post The first name is still "Ant" and both getters return the same pointer
+ */
+void test03_character_set_name();
+
+/**
+ * @test Test adding a message to a character that already has the maximum
+ * @pre A character with MAX_MESSAGES messages
+ * @post Output == ERROR and the number of messages does not change
+ */
+void test03_character_add_message();
+
+/**
+ * @test Test copying a character into an arena
+ * @pre A character with a name, two messages and a health of 4, which chats and loses health after copying it
+ * @post The copy has the same name, a health of 4 and says the first message
+ */
+void test01_character_copy_in_arena();
+
+/**
+ * @test Test setting the turn of the next message of a character
+ * @pre A character with two messages that has already said the first one
+ * @post Output == OK and the character says the first message again
+ */
+void test01_character_set_message_turn();
+
+/**
+ * @test Test setting a turn past the messages of a character, and the turn of a NULL character
+ * @pre A character with one message and a NULL pointer
+ * @post Output == ERROR in both cases and the turn does not change
+ */
+void test02_character_set_message_turn();
+
+#endif
@@ -11,6 +11,7 @@
 #ifndef CINEMATICS_H
 #define CINEMATICS_H
 #include "types.h"
+#include "arena.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -46,6 +47,23 @@ typedef struct _Cinematics_text Cinematics_text;
  */
 Cinematics_text *cinematics_text_create();
 
+/**
+ * @brief Creates a new Cinematics_text structure in an arena
+ * @author agent
+ * @param arena the arena the structure is allocated from, or NULL to allocate it on its own like cinematics_text_create
+ * @return pointer to the created structure, which cinematics_text_destroy does not free if it is in an arena
+ */
+Cinematics_text *cinematics_text_create_in_arena(Arena *arena);
+
+/**
+ * @brief Creates a copy of a Cinematics_text structure in an arena
+ * @author agent
+ * @param arena the arena the copy is allocated from, or NULL to allocate it on its own
+ * @param ct pointer to the structure to copy
+ * @return pointer to the copy, NULL in case of error
+ */
+Cinematics_text *cinematics_text_copy_in_arena(Arena *arena, Cinematics_text *ct);
+
 /**
  * @brief frees the memory of a Cinematics_text structure
  * @author Matteo Artunedo
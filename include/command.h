@@ -18,6 +18,7 @@
 #define N_CMD 18       /*!< Number of commands that are possible*/
 
 #define MAX_CMD_ARG 20 /*!< Maximum number of characters in the argument parameter of the command*/
+#define ARG_LENGTH 50  /*!< Size of the arguments of a command, with the '\0'*/
 #define NO_ARG NULL    /*!< the pointer defined for no argument*/
 
 #define USE_ARG " over " /*!< Defines the separator corresponding to the USE command */
@@ -20,14 +20,11 @@
 #include "link.h"
 #include "cinematics.h"
 #include "mission.h"
+#include "saver.h"
+#include "rng.h"
 
-#define MAX_SPACES 100              /*!<The maximum ammount of spaces that can exist in the game*/
-#define MAX_OBJECTS 25             /*!<The maximum ammount of objects present at the game*/
-#define MAX_CHARACTERS 10           /*!<The maximum ammount of characters present at the game*/
-#define MAX_LINKS (MAX_SPACES * 6)  /*!<The maximum amount of links present at the game*/
 #define MAX_MESSAGE 75              /*!<The maximum ammout of characters in the messages*/
 #define MAX_PLAYERS 2               /*!<The maximum ammout of players that can play at the same time*/
-#define MAX_MISSIONS 10             /*!<The maximum ammount of missions that can be in the game*/
 
 /**
  * @brief This enumeration matches the numerical value of the turn with the player it corresponds to
@@ -89,6 +86,86 @@ Status game_create(Game **game);
  */
 Status game_create_from_file(Game **game, char *filename);
 
+/**
+ * @brief creates a game that is a copy of another one, in the same state
+ *
+ * @date 18-10-2026
+ * @author agent
+ *
+ * The entities are copied field by field into the arena of the new game. Their texts and graphic descriptions
+ *  never change, so they are shared with the original instead of being copied.
+ * @param copy a double pointer where the new game is stored
+ * @param game a pointer to the game to copy, which is not modified
+ * @return Status: if the function was completed succesfully
+ */
+Status game_create_copy(Game **copy, Game *game);
+
+/**
+ * @brief Makes room in the game for a number of spaces, objects, characters, links and missions
+ * @author agent
+ *
+ * The tables of the game grow by themselves as the entities are added, this only saves the intermediate steps
+ *  when the number of entities is known beforehand. The counts smaller than the current room are ignored.
+ * @param game a pointer to the game
+ * @param n_spaces the number of spaces
+ * @param n_objects the number of objects
+ * @param n_characters the number of characters
+ * @param n_links the number of links
+ * @param n_missions the number of missions
+ * @return Status OK or ERROR
+ */
+Status game_reserve(Game *game, int n_spaces, int n_objects, int n_characters, int n_links, int n_missions);
+
+/**
+ * @brief Takes every object and character out of the spaces and every object out of the backpacks of the players, so they can be placed again
+ * @author agent
+ * @param game a pointer to the game
+ * @return Status OK or ERROR
+ */
+Status game_clear_placements(Game *game);
+
+/**
+ * @brief Gets the hash of the static content of the world of the game, which the snapshots of its state are tied to
+ * @author agent
+ * @param game a pointer to the game
+ * @return the hash, 0 if it has not been set
+ */
+unsigned long game_get_world_hash(Game *game);
+
+/**
+ * @brief Sets the hash of the static content of the world of the game, it is kept by the copies of the game
+ * @author agent
+ * @param game a pointer to the game
+ * @param hash the hash
+ * @return Status OK or ERROR
+ */
+Status game_set_world_hash(Game *game, unsigned long hash);
+
+/**
+ * @brief Gets the generator of the random numbers of the game, which its copies and snapshots keep the state of
+ * @author agent
+ * @param game a pointer to the game
+ * @return the generator, NULL in case of error
+ */
+Rng *game_get_rng(Game *game);
+
+/**
+ * @brief Gets the save of the game that is being written in the background
+ * @author agent
+ * @param game a pointer to the game
+ * @return the saver, NULL if no save is being written
+ */
+Saver *game_get_saver(Game *game);
+
+/**
+ * @brief Sets the save of the game that is being written in the background, the game waits for it when it is destroyed
+ * @author agent
+ * @param game a pointer to the game
+ * @param saver the saver, or NULL once it has finished
+ * @return Status OK or ERROR
+ */
+Status game_set_saver(Game *game, Saver *saver);
+
 /**
  * @brief frees all the dynamically allocated memory in the game structure
  *
@@ -111,6 +188,17 @@ Status game_destroy(Game *game);
  * @return a pointer to the desired space
  */
 Space *game_get_space(Game *game, Id id);
+
+/**
+ * @brief gets the arena the entities of the game are allocated from
+ * @author agent
+ *
+ * The spaces, objects, characters, links and missions created in it are not freed when they are destroyed,
+ *  all of them are released together by game_destroy.
+ * @param game a pointer to the game
+ * @return a pointer to the arena, or NULL if the game is NULL
+ */
+Arena *game_get_arena(Game *game);
 /**
  * @brief gets the number of spaces in the game
  * @date 18-04-2025
@@ -455,6 +543,17 @@ Link *game_get_link(Game *game, Id id);
 */
 Status game_add_link(Game *game, Link *link);
 
+/**
+ * @brief Places every link in the table of links of its origin space
+ * @author agent
+ *
+ * game_add_link places the link when its origin space already exists. The data files may list a link before
+ *  its space, so this is called once the whole file has been read.
+ * @param game pointer to the game
+ * @return Status OK or ERROR
+ */
+Status game_place_links(Game *game);
+
 /**
  * @brief Fetches if a link matching input parameters is open or not [Time: O(n)] 
  * @author Guilherme Povedano
@@ -605,6 +704,14 @@ Status game_kill_current_player(Game *game);
  */
 Status game_interface_data_set_last_command(Game *game, Command *last_cmd);
 
+/**
+ * @brief Takes the last command out of the history of the current player, the older ones move up and an empty command is left as the third to last
+ * @author agent
+ * @param game a pointer to the structure with the game's main information
+ * @return the last command, which the caller must destroy or give back with game_interface_data_set_last_command, or NULL in case of error
+ */
+Command *game_interface_data_take_last_command(Game *game);
+
 /**
  * @brief Returns the last, second to last or third to last command according to the position argument
  * @author Matteo Artunedo
@@ -747,7 +854,8 @@ Object* game_get_object_from_name(Game *game, char *object_name);
  *
  * This function searches for the specified object in the game's object array
  * and removes it by replacing it with the last object in the array.
- * The number of objects in the game is then decreased.
+ * The number of objects in the game is then decreased. The object is kept apart as removed,
+ * so the state of a snapshot saved before can bring it back.
  *
  * @param game Pointer to the Game structure.
  * @param object Pointer to the Object to be removed.
@@ -775,7 +883,8 @@ Object* game_get_object_from_name(Game *game, char *object_name);
  *
  * This function searches for the specified object in the game's object array
  * and removes it by replacing it with the last object in the array.
- * The number of objects in the game is then decreased.
+ * The number of objects in the game is then decreased. The object is kept apart as removed,
+ * so the state of a snapshot saved before can bring it back.
  *
  * @param game Pointer to the Game structure.
  * @param object Pointer to the Object to be removed.
@@ -783,6 +892,32 @@ Object* game_get_object_from_name(Game *game, char *object_name);
  */
 Bool game_remove_object(Game *game, Object *object);
 
+/**
+ * @brief Gets the number of objects that have been removed from the game
+ * @author agent
+ * @param game a pointer to the game
+ * @return the number of removed objects, -1 in case of error
+ */
+int game_get_n_removed_objects(Game *game);
+
+/**
+ * @brief Gets an object that has been removed from the game
+ * @author agent
+ * @param game a pointer to the game
+ * @param pos the position of the object among the removed ones
+ * @return a pointer to the object, or NULL in case of error
+ */
+Object *game_get_removed_object_in_pos(Game *game, int pos);
+
+/**
+ * @brief Puts back in the game an object that had been removed from it, it is not placed anywhere
+ * @author agent
+ * @param game a pointer to the game
+ * @param id the id of the object
+ * @return Status OK, or ERROR if no removed object has that id
+ */
+Status game_restore_object(Game *game, Id id);
+
 /**
  * @brief sets the lights_on component of game, which determines how the rooms are shown
  * @author Matteo Artunedo
@@ -24,91 +24,65 @@
  /*declaration of public functions*/
  
  /**
-  * @brief creates a new space from the text of a file, the text must be in a specific format, separated by '|'
-  * gets all the information needed to create a new space.
+  * @brief loads the whole world described in a data or saved file, the text must be in a specific format, separated by '|'
+  * The file is read only once: each line is dispatched according to the tag it starts with
+  * (#s:, #o:, #p:, #c:, #l:, #cin:, #mo: and #mt:). The state of a saved game (#t:, #i:, #ccur:,
+  * #mcur: and #light:) is applied once the whole world has been read.
   *
-  * @date 10-02-2025
+  * @date 18-10-2026
   * @author Álvaro Inigo
   *
-  * @param game a pointer to the structure with the game's main information
+  * @param game a pointer to the structure with the game's main information, already created
   * @param filename the name of the text file
-  * @return Status: if the function was completed succesfully
-  */
- Status gameManagement_load_spaces(Game *game, char *filename);
- 
- /**
-  * @brief Creates the objects given the data file given a specific format.
-  *
-  * @date 7-03-2025
-  * @author Álvaro Inigo
-  *
-  * @param game a pointer to the structure with the game's main information
-  * @param filename the name of the text file
-  * @return Status: if the function was completed succesfully
-  */
- Status gameManagement_load_objects(Game *game, char *filename);
- 
- /**
-  * @brief Creates the players given the data file from a specific format
-  * @date 24-03-2025
-  * @author Álvaro Inigo
-  * @param game a pointer to game
-  * @param filename the name of the text file
-  * @return Status OK of ERROR
-  */
- Status gameManagement_load_players(Game *game, char *filename);
- 
- /**
-  * @brief Creates the characters given the data file from a specific format
-  * @date 24-03-2025
-  * @author Álvaro Inigo
-  * @param game a pointer to game
-  * @param filename the name of the text file
-  * @return Status OK of ERROR
+  * @return Status OK or ERROR
   */
- Status gameManagement_load_characters(Game *game, char *filename);
- 
+ Status gameManagement_load_world(Game *game, char *filename);
+
  /**
-  * @brief Creates the links given the data file from a specific format
-  * @date 25-03-2025
-  * @author Álvaro Inigo
-  * @param game a pointer to game
-  * @param filename the name of the text file
-  * @return Status OK of ERROR
+  * @brief saves the state of the game in a file, as a snapshot tied to the world of the game (see snapshot.h)
+  * @author Alvaro Inigo
+  * @param game a pointer to the game
+  * @param filename the name of the file to save into
+  * @return Status OK or ERROR
   */
- Status gameManagement_load_links(Game *game, char *filename);
+ Status gameManagement_save(Game *game, char *filename);
 
  /**
-  * @brief Creates the cinematics given the data file from a specific format
-  * @author Matteo Artunedo
-  * @date 28-04-2025
+  * @brief saves the state of the game in a file the way gameManagement_save does, but writing it in the background
+  * @author agent
+  *
+  * The snapshot is taken at once, so it is the state of the game when it is called, and then written by a thread of
+  *  its own while the game goes on. A save of the game still being written is not waited for: the new one is
+  *  written after it, and if it fails gameManagement_save_finish still tells so.
   * @param game a pointer to the game
-  * @param filename the name of the text file
-  * @return Status OK or ERROR
+  * @param filename the name of the file to save into
+  * @return Status OK if the save has been started, ERROR otherwise
   */
- Status gameManagement_load_cinematics(Game *game, char *filename);
+ Status gameManagement_save_background(Game *game, char *filename);
 
  /**
-  * @brief loads the missions from a file
+  * @brief tells if the game has a save that is still being written in the background
   * @author Alvaro Inigo
   * @param game a pointer to the game
-  * @param filename the name of the file to read
-  * @return Status OK or ERROR
+  * @return TRUE if the save has not finished yet, FALSE otherwise
   */
- Status gameManagement_load_missions(Game *game, char *filename);
+ Bool gameManagement_save_pending(Game *game);
 
  /**
-  * @brief saves all the information related to the game in a file acording to a specific format
+  * @brief waits for the save of the game that is being written in the background
   * @author Alvaro Inigo
   * @param game a pointer to the game
-  * @param filename the name of the file to save into
-  * @return Status OK or ERROR
+  * @return Status OK if the file was written or there was no save, ERROR otherwise
   */
- Status gameManagement_save(Game *game, char *filename);
+ Status gameManagement_save_finish(Game *game);
 
  /**
   * @brief loads all the information of the game for the command load
   * @author Alvaro Inigo
+  *
+  * A snapshot is restored into a copy of the game and rejected if it is not of the same world. A text file
+  *  (a data file or a saved game of the older format) is restored the same way if it describes the same world,
+  *  and read as a whole new world otherwise. The game is only replaced if the load succeeds.
   * @param game a pointer to the game
   * @param filename the name of the file to read
   * @return Status OK or ERROR
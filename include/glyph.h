@@ -0,0 +1,81 @@
+/**
+ * @file glyph.h
+ * @author agent
+ * @brief This file defines the functions used to handle the UTF-8 glyphs of the graphic descriptions
+ * @version 0.1
+ * @date 18-10-2026
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#ifndef GLYPH_H
+#define GLYPH_H
+
+#include "types.h"
+
+#define GLYPH_ESCAPE_SIZE 4 /*!<Size of an escaped byte in the data files, for instance \xF0*/
+#define GLYPH_MAX_BYTES 4   /*!<Maximum number of bytes of an UTF-8 character*/
+
+/**
+ * @brief Decodes the \xHH escape sequences of a graphic description into the real UTF-8 bytes
+ * @author agent
+ * @date 18-10-2026
+ * @param dest string where the decoded graphic description is stored
+ * @param src graphic description as it is written in the data files
+ * @param size size of dest, with the '\0' included
+ * @return Status OK or ERROR
+ */
+Status glyph_decode(char *dest, const char *src, int size);
+
+/**
+ * @brief Escapes the non ASCII bytes of a graphic description as \xHH, the way they are written in the data files
+ *
+ * The '\\' are escaped too, so glyph_decode gives back the same description
+ * @author agent
+ * @date 18-10-2026
+ * @param dest string where the escaped graphic description is stored
+ * @param src decoded graphic description
+ * @param size size of dest, with the '\0' included
+ * @return Status OK if the whole graphic description fits in dest, ERROR otherwise
+ */
+Status glyph_encode(char *dest, const char *src, int size);
+
+/**
+ * @brief Gets the number of bytes of the UTF-8 character that starts with a given byte
+ * @author agent
+ * @date 18-10-2026
+ * @param lead first byte of the character
+ * @return int the number of bytes of the character (1 for ASCII and for invalid lead bytes)
+ */
+int glyph_sequence_length(unsigned char lead);
+
+/**
+ * @brief Gets the number of columns a Unicode codepoint occupies in the terminal
+ * @author agent
+ * @date 18-10-2026
+ * @param codepoint the codepoint
+ * @return int 2 for wide characters (emoticons and east asian characters), 1 otherwise
+ */
+int glyph_codepoint_width(long codepoint);
+
+/**
+ * @brief Reads the UTF-8 character that starts at a given position of a string
+ * @author agent
+ * @date 18-10-2026
+ * @param str pointer to the first byte of the character
+ * @param len pointer where the number of bytes read is stored (1 if the character is not valid)
+ * @return long the codepoint of the character, -1 if it is not a complete and valid UTF-8 character
+ */
+long glyph_utf8_decode(const char *str, int *len);
+
+/**
+ * @brief Writes the UTF-8 bytes of a Unicode codepoint
+ * @author agent
+ * @date 18-10-2026
+ * @param codepoint the codepoint
+ * @param dest string where the bytes are written, with room for GLYPH_MAX_BYTES bytes (it is not NULL-terminated)
+ * @return int the number of bytes written
+ */
+int glyph_utf8_encode(long codepoint, char *dest);
+
+#endif
@@ -26,14 +26,27 @@
  */
 typedef struct _Graphic_engine Graphic_engine;
 
+/**
+ * @brief Backends the graphic engine can use to show the game
+ * @author agent
+ */
+typedef enum
+{
+  ANSI_RENDERER,  /*!<The whole interface is painted in the terminal*/
+  NULL_RENDERER,  /*!<Nothing is painted, used for headless replays*/
+  DIGEST_RENDERER /*!<Nothing is painted, only a digest of the game state is printed in each frame*/
+} Renderer_type;
+
 /**
  * @brief Creates a new graphic engine
  *
  * @date 27-01-2025
  * @author Matteo Artunedo
  *
+ * @param renderer backend used to show the game. The screen and its areas are only created for the ANSI_RENDERER
+ * @return a pointer to the new graphic engine, or NULL in case of error
  */
-Graphic_engine *graphic_engine_create();
+Graphic_engine *graphic_engine_create(Renderer_type renderer);
 
 /**
  * @brief frees the memory allocated for all the areas of the screen, which are stored in the pointer to the graphic engine
@@ -56,5 +69,29 @@ void graphic_engine_destroy(Graphic_engine *ge);
  */
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game);
 
+/**
+ * @brief Gets the backend used by the graphic engine
+ *
+ * @date 18-10-2026
+ * @author agent
+ *
+ * @param ge pointer to the game's textual graphic engine
+ * @return the Renderer_type of the graphic engine, ANSI_RENDERER if ge is NULL
+ */
+Renderer_type graphic_engine_get_renderer(Graphic_engine *ge);
+
+/**
+ * @brief Gets the digest of the game state computed in the last frame painted by the DIGEST_RENDERER
+ *
+ * @date 18-10-2026
+ * @author agent
+ *
+ * The digest only depends on the state of the game (turn, players, objects, characters, links...),
+ *  so two replays of the same commands must produce the same digests.
+ * @param ge pointer to the game's textual graphic engine
+ * @return the digest, 0 if ge is NULL or no frame has been painted yet
+ */
+unsigned long graphic_engine_get_digest(Graphic_engine *ge);
+
 
 #endif
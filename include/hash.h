@@ -0,0 +1,28 @@
+/**
+ * @brief It defines the hash used by the tables, the checksums and the digests of the game
+ *
+ * @file hash.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#define HASH_START 2166136261UL /*!<Hash of no bytes, the first ones are added to it (FNV-1a)*/
+
+/**
+ * @brief Adds some bytes to a hash (FNV-1a)
+ * @author agent
+ *
+ * The hash of some data can be computed in parts, adding each part to the hash of the previous ones.
+ * @param hash the hash of the previous bytes, HASH_START for the first ones
+ * @param data the bytes
+ * @param size the number of bytes
+ * @return the new hash, in 32 bits whatever the size of unsigned long
+ */
+unsigned long hash_bytes(unsigned long hash, const char *data, long size);
+
+#endif
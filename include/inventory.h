@@ -13,6 +13,7 @@
  
 #include "types.h"
 #include "set.h"
+#include "location.h"
  
 /**
  * @brief Definition of the inventory type
@@ -28,6 +29,14 @@
  */
 Inventory* inventory_create(int max_objs);
 
+/**
+ * @brief This function creates a copy of an inventory, with the same objects and maximum number of objects
+ * @author agent
+ * @param inventory A pointer to the inventory to copy.
+ * @return A pointer to the copy, which has no index of locations until it is given one, or NULL in case of error.
+ */
+Inventory *inventory_copy(Inventory *inventory);
+
 /**
 * @brief This function destroys an inventory and frees the memory allocated for the Inventory structure and its associated Set of objects
 * @author PPROG Team 2101_D - AGL
@@ -131,6 +140,16 @@ Status inventory_del_object_id(Inventory* inventory, Id obj_id);
  */
 Status inventory_print(Inventory *inventory);
 
+/**
+ * @brief Sets the index where the inventory keeps which objects are in it, the objects it already has are added to the index.
+ * @author agent
+ * @param inventory A pointer to the Inventory structure.
+ * @param index A pointer to the index of the places of the objects, it is still owned by the caller.
+ * @param owner The ID of the player the inventory belongs to.
+ * @return OK if the index was successfully set, ERROR if the inventory pointer is NULL.
+ */
+Status inventory_set_location_index(Inventory *inventory, Location_index *index, Id owner);
+
 
  
  #endif 
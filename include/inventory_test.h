@@ -240,7 +240,39 @@ void test2_inventory_del_object_id();
  */
 void test3_inventory_del_object_id();
 
+/**
+ * @test Tests if inventory_set_location_index records the objects the inventory already has.
+ * @pre An inventory with the object 1 and an empty index.
+ * @post The function returns OK and the index says that the object 1 is in the backpack of the player 2.
+ */
+void test1_inventory_set_location_index();
 
- 
- #endif
- 
\ No newline at end of file
+/**
+ * @test Tests if inventory_set_location_index correctly returns ERROR when the inventory pointer is NULL.
+ * @pre The inventory pointer is set to NULL.
+ * @post The function returns ERROR.
+ */
+void test2_inventory_set_location_index();
+
+/**
+ * @test Tests if the objects added to an inventory are recorded in its index.
+ * @pre An empty inventory of the player 2 with an index.
+ * @post After adding the object 1, the index says that it is in the backpack of the player 2.
+ */
+void test3_inventory_set_location_index();
+
+/**
+ * @test Tests if the objects removed from an inventory are no longer in its index.
+ * @pre An inventory of the player 2 with an index and the object 1.
+ * @post After removing the object 1, the index says that it is nowhere.
+ */
+void test4_inventory_set_location_index();
+
+ /**
+  * @test Tests if the copy of an inventory keeps its objects after the inventory changes.
+ * @pre An inventory with the object 1, which is removed after copying it.
+ * @post The copy has the object 1 and the same maximum number of objects.
+ */
+void test1_inventory_copy();
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @brief It defines the journal, the file where the commands of a game are kept as they are played so the game can be recovered
+ *
+ * @file journal.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include "types.h"
+#include "game.h"
+#include "command.h"
+
+#define JOURNAL_VERSION 3           /*!<Version of the format of the journals, journals of other versions are rejected*/
+#define JOURNAL_CHECKPOINT_TURNS 32 /*!<Number of commands after which a checkpoint of the game is written*/
+
+/**
+ * @brief Journal of a game
+ * @author agent
+ */
+typedef struct _Journal Journal;
+
+/**
+ * @brief Opens the journal of a game, creating it if it does not exist
+ * @author agent
+ *
+ * If the journal already has a game, the game is taken to its last checkpoint, or to the random numbers it started with,
+ *  and the commands played after it are kept to be played again (see journal_next). The random numbers are those of the
+ *  game, so the commands give the same results when they are played again. A command that was not completely written is dropped.
+ * @param filename the name of the journal, the checkpoints are written next to it adding .0 and .1 to the name
+ * @param game a pointer to the game, just created from the world the journal was started with
+ * @return a pointer to the journal, or NULL if it cannot be opened or was started with another world
+ */
+Journal *journal_open(char *filename, Game **game);
+
+/**
+ * @brief Closes a journal, waiting for the checkpoint being written
+ * @author agent
+ * @param journal the journal
+ * @param finished TRUE if the game has finished, then the journal and its checkpoints are deleted
+ */
+void journal_close(Journal *journal, Bool finished);
+
+/**
+ * @brief Tells if there are commands of the journal still to be played again
+ * @author agent
+ * @param journal the journal, it can be NULL
+ * @return TRUE if there are, FALSE otherwise
+ */
+Bool journal_replaying(Journal *journal);
+
+/**
+ * @brief Gets the next command of the journal to be played again
+ * @author agent
+ * @param journal the journal
+ * @param command the command, where the code and the arguments are set
+ * @return Status OK or ERROR if there are no commands left
+ */
+Status journal_next(Journal *journal, Command *command);
+
+/**
+ * @brief Adds a command that has just been played at the end of the journal
+ * @author agent
+ *
+ * The commands that depend on other files, like save and load, must not be added, as playing them again could give another game.
+ * @param journal the journal
+ * @param command the command
+ * @return Status OK or ERROR
+ */
+Status journal_append(Journal *journal, Command *command);
+
+/**
+ * @brief Writes the checkpoints of the game, to be called once per turn
+ * @author agent
+ *
+ * Every JOURNAL_CHECKPOINT_TURNS commands a snapshot of the game is written in the background. Once it is on disk,
+ *  the commands it already has are dropped from the journal.
+ * @param journal the journal
+ * @param game the game
+ * @return Status OK or ERROR if a checkpoint could not be written
+ */
+Status journal_update(Journal *journal, Game *game);
+
+/**
+ * @brief Writes a checkpoint of the game at once, waiting until it is on disk
+ * @author agent
+ *
+ * It is used instead of adding a command that cannot be played again, like load, so the journal goes on from the game it gave.
+ *  If the game stops before the checkpoint is written, it is recovered as it was before that command.
+ * @param journal the journal
+ * @param game the game
+ * @return Status OK or ERROR if the checkpoint could not be written
+ */
+Status journal_checkpoint(Journal *journal, Game *game);
+
+#endif
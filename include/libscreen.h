@@ -11,8 +11,12 @@
 #ifndef LIBSCREEN_H
 #define LIBSCREEN_H
 #include "types.h"
-#include "character.h"
 
+/**
+ * @brief Definition of Screen type for the _Screen structure
+ * 
+ */
+typedef struct _Screen Screen;
 /**
  * @brief Definition of Area type for the _Area structure
  * 
@@ -32,10 +36,12 @@ typedef enum {RED, GREEN, BLACK, BLUE, YELLOW, PURPLE, CYAN, WHITE} Frame_color;
  *
  * This function should be called at the beginning of the program,
  *  so the complete screen is allocated before starting defining areas.
+ *  Each screen keeps its own cells and output buffer, so several of them can coexist.
  * @param rows the number of rows that will have the full screen
  * @param columns the number of columns that will have the full screen
+ * @return a new screen, initialized, or NULL in case of error
  */
-void screen_init(int rows, int columns);
+Screen* screen_init(int rows, int columns);
 
 /**
  * @brief It destroys a new screen area
@@ -43,19 +49,23 @@ void screen_init(int rows, int columns);
  *
  * As it frees the screen, it must be called at the end of the program,
  *  once the areas created have been freed.
+ * @param screen the screen to be freed
  */
-void screen_destroy();
+void screen_destroy(Screen* screen);
 
 /**
  * @brief It paints in the terminal the actual screen composition
  * @author Matteo Artunedo
  *
+ * @param screen the screen to be painted
  * @param color color that will be used for the background areas
  * @param lights_on boolean value that describes if the lights in the game are turned on or off
  * This function should be called when some updates
- *  in the screen want to be shown.
+ *  in the screen want to be shown. The whole frame is assembled in a
+ *  reusable buffer and sent to the terminal with a single write. Only the
+ *  spans of cells that changed since the last call are sent, unless the colors change.
  */
-void screen_paint(Frame_color color, Bool lights_on);
+void screen_paint(Screen* screen, Frame_color color, Bool lights_on);
 
 /**
  * @brief It creates a new area inside a screen
@@ -63,13 +73,14 @@ void screen_paint(Frame_color color, Bool lights_on);
  *
  * screen_area_init allocates memory for a new area
  *  and initializes its members.
+ * @param screen the screen the area belongs to
  * @param x the x-coordinate of the up-left corner of the area
  * @param y the x-coordinate of the up-left corner of the area
  * @param width the width of the area
  * @param height the height of the area
- * @return a new area, initialized
+ * @return a new area, initialized, or NULL if it does not fit in the screen
  */
-Area* screen_area_init(int x, int y, int width, int height);
+Area* screen_area_init(Screen* screen, int x, int y, int width, int height);
 
 /**
  * @brief It destroys a new screen area
@@ -105,7 +116,8 @@ void screen_area_reset_cursor(Area* area);
  * @author Profesores PPROG
  *
  * This function sets the string that will be shown in an area.
- *  Each string introduced will be a line in the specified area.
+ *  Each string introduced will be a line in the specified area. The string
+ *  is read as UTF-8, and wide characters take two cells of the area.
  * @param area the area to be modified
  * @param str a string that contains the information to be included in a particular area
  */
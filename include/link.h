@@ -11,6 +11,7 @@
 #define LINK_H
 
 #include "types.h"
+#include "arena.h"
 
 #define HIDDENROOMTOTREASURE 3132   /*!< Link ID for the hidden room to treasure room connection */
 #define LIVINGROOMTOHALL1  1421     /*!< Link ID for the living room to hall 1 connection */
@@ -33,6 +34,26 @@ typedef struct _Link Link;
 */
 Link *link_create(Id link_id);
 
+/**
+ * @brief Carves a new link structure from an arena and initializes it
+ * @author agent
+ * @date 18-10-2026
+ * @param arena the arena the link is allocated from, or NULL to allocate it on its own like link_create
+ * @param link_id the unique id for the newly created link
+ * @return A pointer to the new link, which link_destroy does not free if it is in an arena, or NULL in case of error
+*/
+Link *link_create_in_arena(Arena *arena, Id link_id);
+
+/**
+ * @brief Creates a copy of a link in an arena, which is open if the link is
+ * @author agent
+ * @date 18-10-2026
+ * @param arena the arena the copy is allocated from, or NULL to allocate it on its own
+ * @param l pointer to the link to copy
+ * @return A pointer to the copy, or NULL in case of error
+*/
+Link *link_copy_in_arena(Arena *arena, Link *l);
+
 /**
  * @brief frees any allocated memory for a given link 
  * @author Guilherme Povedano 
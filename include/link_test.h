@@ -266,4 +266,18 @@ void test01_link_get_name();
 */
 void test02_link_get_name();
 
-#endif
\ No newline at end of file
+/**
+ * @test link creation in an arena
+ * @pre An arena and a valid id
+ * @post link is created, link_destroy leaves its memory to be released with the arena
+*/
+void test01_link_create_in_arena();
+
+/**
+ * @test Test copying a link into an arena
+ * @pre A closed link with a name, which is opened after copying it
+ * @post The copy has the same id and name, and is closed
+ */
+void test01_link_copy_in_arena();
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * @brief It defines the index that keeps where each object of the game is
+ *
+ * @file location.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LOCATION_H
+#define LOCATION_H
+
+#include "types.h"
+
+/**
+ * @brief Kinds of places where an object can be kept
+ * @author agent
+ */
+typedef enum
+{
+  NOWHERE,    /*!<The object is not in any space or backpack (it has not appeared yet or it has been removed)*/
+  IN_SPACE,   /*!<The object is in a space*/
+  IN_BACKPACK /*!<The object is in the backpack of a player*/
+} Container_type;
+
+/**
+ * @brief Index from the id of each object to the space or backpack where it is
+ * @author agent
+ */
+typedef struct _Location_index Location_index;
+
+/**
+ * @brief Creates an empty index
+ * @author agent
+ * @return a pointer to the new index, or NULL in case of error
+ */
+Location_index *location_index_create();
+
+/**
+ * @brief Frees the memory of an index
+ * @author agent
+ * @param index the index
+ */
+void location_index_destroy(Location_index *index);
+
+/**
+ * @brief Sets the place where an object is
+ * @author agent
+ * @param index the index
+ * @param object the id of the object
+ * @param type the kind of place
+ * @param container the id of the space or of the player whose backpack has the object
+ * @return Status OK or ERROR
+ */
+Status location_index_set(Location_index *index, Id object, Container_type type, Id container);
+
+/**
+ * @brief Marks an object as being nowhere, only if it is still in the given place
+ * @author agent
+ *
+ * When an object is moved, it is added to its new place before being deleted from the old one,
+ *  so the deletion must not forget the new place.
+ * @param index the index
+ * @param object the id of the object
+ * @param type the kind of place the object is being deleted from
+ * @param container the id of the space or player the object is being deleted from
+ * @return Status OK or ERROR
+ */
+Status location_index_remove(Location_index *index, Id object, Container_type type, Id container);
+
+/**
+ * @brief Gets the place where an object is
+ * @author agent
+ * @param index the index
+ * @param object the id of the object
+ * @param container pointer where the id of the space or player is stored, NO_ID if the object is nowhere
+ * @return the kind of place, NOWHERE if the object is not in the index
+ */
+Container_type location_index_get(Location_index *index, Id object, Id *container);
+
+#endif
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "types.h"
+#include "arena.h"
 
 
 #define MAX_MISSION_MESSAGE 150  /*!<The maximum ammount of chars a message can have*/
@@ -51,6 +52,23 @@ typedef enum{
  */
 Mission *mission_create();
 
+/**
+ * @brief creates a new Mission in an arena
+ * @author agent
+ * @param arena the arena the mission is allocated from, or NULL to allocate it on its own like mission_create
+ * @return Mission* a pointer to the new created mission, which mission_destroy does not free if it is in an arena
+ */
+Mission *mission_create_in_arena(Arena *arena);
+
+/**
+ * @brief creates a copy of a Mission in an arena, at the same step and with the same next dialogue and objective
+ * @author agent
+ * @param arena the arena the copy is allocated from, or NULL to allocate it on its own
+ * @param mission the mission to copy
+ * @return Mission* a pointer to the copy, NULL in case of error
+ */
+Mission *mission_copy_in_arena(Arena *arena, Mission *mission);
+
 /**
  * @brief Destroys a mission and frees all the memory allocated
  * @author Alvaro Inigo
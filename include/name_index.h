@@ -0,0 +1,67 @@
+/**
+ * @brief It defines the index that finds the entities of the game by their names
+ *
+ * @file name_index.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include "types.h"
+
+/**
+ * @brief Index from a name, without taking the case into account, to the entity (object, character or player) that has it
+ * @author agent
+ */
+typedef struct _Name_index Name_index;
+
+/**
+ * @brief Creates an empty index
+ * @author agent
+ * @return a pointer to the new index, or NULL in case of error
+ */
+Name_index *name_index_create();
+
+/**
+ * @brief Frees the memory of an index, the entities are not freed
+ * @author agent
+ * @param index the index
+ */
+void name_index_destroy(Name_index *index);
+
+/**
+ * @brief Adds the name of an entity to the index
+ * @author agent
+ *
+ * If the name (in any case) is already in the index, the entity that was added first is kept.
+ * @param index the index
+ * @param name the name of the entity
+ * @param entity a pointer to the entity
+ * @return Status OK or ERROR
+ */
+Status name_index_add(Name_index *index, const char *name, void *entity);
+
+/**
+ * @brief Removes a name from the index, only if it belongs to the given entity
+ * @author agent
+ * @param index the index
+ * @param name the name of the entity
+ * @param entity a pointer to the entity
+ * @return Status OK or ERROR
+ */
+Status name_index_remove(Name_index *index, const char *name, void *entity);
+
+/**
+ * @brief Finds the entity that has a name, without taking the case into account
+ * @author agent
+ * @param index the index
+ * @param name the name
+ * @return a pointer to the entity, or NULL if no entity has that name
+ */
+void *name_index_find(Name_index *index, const char *name);
+
+#endif
@@ -14,6 +14,7 @@
 
 #include "player.h"
 #include "types.h"
+#include "arena.h"
 
 #define BATTERIES_ID 1  /*!<The id of the batteries, used for checking missions*/
 #define LANTERN_ID 2    /*!<The id of the lantern, used for checking missions*/
@@ -52,6 +53,25 @@ typedef struct _Object Object;
  *  or NULL it there was any problem with memory allocation
  */
 Object *object_create(Id id);
+/**
+ * @brief Creates a new object in an arena given its Id
+ * @date 18-10-2026
+ * @author agent
+ * @param arena the arena the object is allocated from, or NULL to allocate it on its own like object_create
+ * @param id the Id of the new object
+ * @return Object * if everything was ok, which object_destroy does not free if it is in an arena,
+ *  or NULL it there was any problem with memory allocation
+ */
+Object *object_create_in_arena(Arena *arena, Id id);
+/**
+ * @brief Creates a copy of an object in an arena, the texts of the object are shared with the copy
+ * @date 18-10-2026
+ * @author agent
+ * @param arena the arena the copy is allocated from, or NULL to allocate it on its own
+ * @param object the object to copy
+ * @return Object * the copy, or NULL if there was any problem with memory allocation
+ */
+Object *object_copy_in_arena(Arena *arena, Object *object);
 /**
  * @brief Destroys a given object and frees the memory.
  * @date 2025-02-10
@@ -212,7 +232,7 @@ char *object_get_gdesc(Object *object);
  * @date 2025-04-25
  * @author Matteo Artunedo
  * @param object a pointer to the object
- * @param gdesc the new gdesc of the object
+ * @param gdesc the new gdesc of the object (\xHH escape sequences are decoded to UTF-8)
  * @return Status: OK or ERROR
  */
 Status object_set_gdesc(Object *object, char *gdesc);
@@ -291,4 +291,32 @@ void test1_object_get_movable();
  */
 void test2_object_get_movable();
 
-#endif
\ No newline at end of file
+/**
+ * @test Test object_set_gdesc with an escaped UTF-8 glyph
+ * @pre A valid object is created, a gdesc with \\xHH escape sequences is passed
+ * @post The stored gdesc contains the decoded UTF-8 bytes
+ */
+void test3_object_set_gdesc();
+
+/**
+ * @test Test object_create_in_arena with valid ID
+ * @pre An arena, and the ID is a valid number (not NO_ID)
+ * @post The returned pointer is not NULL and object_destroy returns OK, the memory is released with the arena
+ */
+void test1_object_create_in_arena();
+
+/**
+ * @test Test that the description is copied and that equal descriptions share their text
+ * @pre Two objects, the first described from a buffer that is then overwritten, the second given the same description
+ * @post The first description is still "A rusty key" and both getters return the same pointer
+ */
+void test3_object_set_description();
+
+/**
+ * @test Test copying an object into an arena
+ * @pre An object with a name and a health of 2, which is changed to 3 after copying it
+ * @post The copy has the same id and name, and a health of 2
+ */
+void test1_object_copy_in_arena();
+
+#endif
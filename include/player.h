@@ -37,6 +37,15 @@ typedef struct _Player Player;
  */
 Player *player_create(Id id, int inventory_size);
 
+/**
+ * @brief It creates a copy of a player, with the same location, health, team and backpack
+ * @author agent
+ *
+ * @param player a pointer to the player to copy
+ * @return the copy, which has no index of locations until it is given one, or NULL in case of error
+ */
+Player *player_copy(Player *player);
+
 /**
  * @brief It destroys a player, freeing the allocated memory
  * @author Matteo Artunedo
@@ -195,7 +204,7 @@ int player_get_health(Player *p);
  * @brief sets the graphic description of a player
  * @author Alvaro Inigo
  * @param player a pointer to the player
- * @param gdesc a pointer to char, the string that contais the graphic description
+ * @param gdesc a pointer to char, the string that contais the graphic description (\xHH escape sequences are decoded to UTF-8)
  * @return Status OK of ERROR
  */
 Status player_set_gdesc(Player *player, char *gdesc);
@@ -250,4 +259,13 @@ Id player_get_team(Player *player);
  * @return Status Ok or ERROR
  */
 Status player_set_team(Player *player, Id team);
+
+/**
+ * @brief Sets the index where the backpack of the player records the objects it has
+ * @author agent
+ * @param player a pointer to the player
+ * @param index a pointer to the index of the places of the objects, it is still owned by the caller
+ * @return Status OK or ERROR
+ */
+Status player_set_location_index(Player *player, Location_index *index);
 #endif
@@ -374,11 +374,18 @@ void test1_player_set_team();
  */
 void test2_player_set_team();
 
+/**
+ * @brief Test whether an escaped emoticon is decoded when it is set as the graphic description.
+ * @pre A valid player created with ID 1 and inventory size 3.
+ * @post The graphic description holds the UTF-8 bytes.
+ */
+void test1_player_set_gdesc();
 
+/**
+ * @test Test copying a player
+ * @pre A player with a name, a location and an object in the backpack, which moves and drops the object after copying it
+ * @post The copy has the same name and location, and still has the object
+ */
+void test1_player_copy();
 
-
-
-
- 
- #endif
- 
\ No newline at end of file
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @brief It defines the reader used to load the data and saved files
+ *
+ * @file reader.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef READER_H
+#define READER_H
+
+#include "types.h"
+
+/**
+ * @brief View of a piece of text inside the file being read, it is not NULL-terminated until field_terminate is called
+ * @author agent
+ */
+typedef struct
+{
+  char *str; /*!<First character of the text*/
+  int len;   /*!<Number of characters of the text*/
+} Field;
+
+/**
+ * @brief Reader that gives the lines of a file without copying them
+ * @author agent
+ */
+typedef struct _Reader Reader;
+
+/**
+ * @brief Opens a file for reading
+ * @author agent
+ *
+ * The file is mapped in memory (or read at once if it can not be mapped),
+ *  the Fields obtained from the reader point inside it until the reader is closed.
+ * @param filename the name of the file
+ * @return a pointer to the new reader, or NULL in case of error
+ */
+Reader *reader_open(char *filename);
+
+/**
+ * @brief Closes a reader, the Fields obtained from it can not be used anymore
+ * @author agent
+ * @param reader the reader
+ */
+void reader_close(Reader *reader);
+
+/**
+ * @brief Gets the next line of the file
+ * @author agent
+ * @param reader the reader
+ * @param line pointer where the view of the line is stored, without the '\n'
+ * @return TRUE if a line has been read, FALSE at the end of the file
+ */
+Bool reader_next_line(Reader *reader, Field *line);
+
+/**
+ * @brief Takes the next field of a line, consuming it and the separator that follows it
+ * @author agent
+ *
+ * As strtok does, consecutive separators are skipped, so there are no empty fields.
+ * @param line view of the rest of the line, it is advanced past the field
+ * @param separators string with the characters that separate the fields
+ * @param field pointer where the view of the field is stored
+ * @return TRUE if a field has been found, FALSE if there are only separators left
+ */
+Bool field_next(Field *line, const char *separators, Field *field);
+
+/**
+ * @brief NULL-terminates a field in the file, overwriting the separator that followed it
+ * @author agent
+ * @param field the field
+ * @return the NULL-terminated string of the field, which stays valid until the reader is closed
+ */
+char *field_terminate(Field *field);
+
+/**
+ * @brief Gets the integer written in a field, the same way atol does
+ * @author agent
+ * @param field the field
+ * @return the value, 0 if the field does not start with a number
+ */
+long field_to_long(Field field);
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @brief It defines the generator of the random numbers of a game
+ *
+ * @file rng.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include "types.h"
+
+#define RNG_STATE_SIZE 4 /*!<Number of words of the state of a generator*/
+
+/**
+ * @brief Generator of random numbers (xoshiro128**)
+ * @author agent
+ *
+ * Each generator has a state of its own, so two games never share their random numbers and the numbers
+ *  of a game can be played again by saving its state and setting it back.
+ */
+typedef struct _Rng Rng;
+
+/**
+ * @brief Creates a generator
+ * @author agent
+ * @param seed the seed, the same seed always gives the same numbers
+ * @return a pointer to the generator, or NULL in case of error
+ */
+Rng *rng_create(unsigned long seed);
+
+/**
+ * @brief Frees a generator
+ * @author agent
+ * @param rng the generator
+ */
+void rng_destroy(Rng *rng);
+
+/**
+ * @brief Starts the numbers of a generator again from a seed
+ * @author agent
+ * @param rng the generator
+ * @param seed the seed
+ * @return Status OK or ERROR
+ */
+Status rng_seed(Rng *rng, unsigned long seed);
+
+/**
+ * @brief Gets the next number of a generator
+ * @author agent
+ * @param rng the generator
+ * @return a number of 32 bits, 0 in case of error
+ */
+unsigned long rng_next(Rng *rng);
+
+/**
+ * @brief Gets the next number of a generator below a limit, all of them equally likely
+ * @author agent
+ * @param rng the generator
+ * @param n the limit
+ * @return a number from 0 to n - 1, 0 if n is not positive or in case of error
+ */
+int rng_range(Rng *rng, int n);
+
+/**
+ * @brief Gets the state of a generator
+ * @author agent
+ * @param rng the generator
+ * @param state where the RNG_STATE_SIZE words of the state are left
+ * @return Status OK or ERROR
+ */
+Status rng_get_state(Rng *rng, unsigned long *state);
+
+/**
+ * @brief Sets the state of a generator, so it gives the numbers it gave when it had that state
+ * @author agent
+ * @param rng the generator
+ * @param state the RNG_STATE_SIZE words of the state, as given by rng_get_state
+ * @return Status OK or ERROR if the state is not valid
+ */
+Status rng_set_state(Rng *rng, const unsigned long *state);
+
+#endif
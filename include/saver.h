@@ -0,0 +1,65 @@
+/**
+ * @brief It defines the saver, that writes the saved games to disk without the file being left half written
+ *
+ * @file saver.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SAVER_H
+#define SAVER_H
+
+#include "types.h"
+
+/**
+ * @brief Write of a file running in the background
+ * @author agent
+ */
+typedef struct _Saver Saver;
+
+/**
+ * @brief Writes some data to a file at once
+ * @author agent
+ *
+ * The data is written to a temporary file next to it, which is synced to disk and then renamed,
+ *  so the file has either the old content or the new one, never a part of it.
+ * @param data the data
+ * @param size the number of bytes of the data
+ * @param filename the name of the file
+ * @return Status OK or ERROR
+ */
+Status saver_write(char *data, long size, char *filename);
+
+/**
+ * @brief Starts writing some data to a file in a thread of its own, the way saver_write does
+ * @author agent
+ *
+ * If there is a previous saver, the thread waits for it before writing, so the files are written in the order
+ *  they were started and none of them is left for the caller to wait on.
+ * @param data the data, allocated with malloc, which belongs to the saver from then on even if it cannot be started
+ * @param size the number of bytes of the data
+ * @param filename the name of the file
+ * @param previous a saver still being written, which belongs to the new saver once it has been started, or NULL
+ * @return a pointer to the saver, or NULL in case of error, and then the previous saver is left as it was
+ */
+Saver *saver_start(char *data, long size, char *filename, Saver *previous);
+
+/**
+ * @brief Tells if a saver has finished writing, without waiting for it
+ * @author agent
+ * @param saver the saver
+ * @return TRUE if the file has been written or could not be, FALSE if it is still being written
+ */
+Bool saver_is_done(Saver *saver);
+
+/**
+ * @brief Waits until a saver has finished writing and frees it
+ * @author agent
+ * @param saver the saver
+ * @return Status OK if the file was written, as well as those of the savers it was started after, ERROR otherwise
+ */
+Status saver_finish(Saver *saver);
+
+#endif
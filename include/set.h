@@ -12,9 +12,10 @@
 #define SET_H
 
 #include "types.h"
+#include "arena.h"
 
 /**
- * @brief Maximum number of elements that can be stored in a set.
+ * @brief Number of elements a set can store before it needs to allocate more memory.
  */
 #define MAX_ELEMENTS_IN_SET 30
 
@@ -32,6 +33,29 @@ typedef struct _Set Set;
  * @return a pointer to the created set
  */
 Set *set_create();
+
+/**
+ * @brief creates an empty set in an arena
+ *
+ * @date 18-10-2026
+ * @author agent
+ *
+ * @param arena the arena the set is allocated from, or NULL to allocate it on its own like set_create
+ * @return a pointer to the created set, which set_destroy does not free if it is in an arena
+ */
+Set *set_create_in_arena(Arena *arena);
+
+/**
+ * @brief creates a copy of a set in an arena, with the same elements in the same order
+ *
+ * @date 18-10-2026
+ * @author agent
+ *
+ * @param arena the arena the copy is allocated from, or NULL to allocate it on its own
+ * @param s a pointer to the set to copy
+ * @return a pointer to the copy, or NULL in case of error
+ */
+Set *set_copy_in_arena(Arena *arena, Set *s);
 /**
  * @brief destroys an existing set
  *
@@ -50,7 +74,7 @@ Status set_destroy(Set *s);
  *
  * @param s a pointer to the set where the element will be added
  * @param elementId the id of the new element
- * @return returns OK if the element is added or if the element is already in the set and ERROR if the given pointer to the set is NULL or the set is full
+ * @return returns OK if the element is added or if the element is already in the set and ERROR if the given pointer to the set is NULL or there is no memory to make the set grow
  */
 Status set_add(Set *s, Id elementId);
 /**
@@ -106,7 +130,7 @@ Bool set_is_empty(Set *s);
  * @author Matteo Artunedo
  *
  * @param s a pointer to the set
- * @return TRUE if the set is full and FALSE if it can contain more elements
+ * @return TRUE if the set is NULL and FALSE otherwise, since sets grow as elements are added
  */
 Bool set_is_full(Set *s);
 
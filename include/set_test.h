@@ -70,6 +70,13 @@ void test3_set_add();
  */
 void test4_set_add();
 
+/**
+ * @test Test adding more elements than MAX_ELEMENTS_IN_SET
+ * @pre A pointer to an empty set and MAX_ELEMENTS_IN_SET + 10 Ids to add
+ * @post The set has all the elements, in the order they were added
+ */
+void test5_set_add();
+
 /**
  * @test Test deleting an element not present in the set
  * @pre A pointer to a set containing the element '5' and an Id '3' to delete
@@ -98,6 +105,13 @@ void test3_set_del();
  */
 void test4_set_del();
 
+/**
+ * @test Test deleting an element from a set with elements far from each other
+ * @pre A pointer to a set containing the elements '1', '100000' and '2', and an Id '100000' to delete
+ * @post The function returns OK, '100000' is no longer in the set and '2' has taken its position
+ */
+void test5_set_del();
+
 /**
  * @test Test printing a NULL set
  * @pre A NULL pointer to a set
@@ -140,6 +154,12 @@ void test3_set_belongs();
  * @post The function returns ERROR, as the Id is 'NO_ID'
  */
 void test4_set_belongs();
+/**
+ * @test Test checking if elements belong to a set with elements far from each other
+ * @pre A pointer to a set containing the elements '1' and '100000'
+ * @post The function returns TRUE for '1' and '100000' and FALSE for '2'
+ */
+void test5_set_belongs();
 /**
  * @test Test checking if a NULL set is empty
  * @pre A NULL pointer to a set
@@ -174,9 +194,9 @@ void test1_set_is_full();
 void test2_set_is_full();
 
 /**
- * @test Test set is full with full set
- * @pre pointer to set with maximum number of elements
- * @post Output==TRUE
+ * @test Test set is full with a set of MAX_ELEMENTS_IN_SET elements
+ * @pre pointer to set with MAX_ELEMENTS_IN_SET elements
+ * @post Output==FALSE, since sets grow as elements are added
  */
 void test3_set_is_full();
 /**
@@ -262,4 +282,18 @@ void test3_set_get_pos_from_Id();
  */
 void test4_set_get_pos_from_Id();
 
-#endif
\ No newline at end of file
+/**
+ * @test Test creating a set in an arena and making it grow
+ * @pre An arena, and MAX_ELEMENTS_IN_SET + 5 Ids to add to the set
+ * @post The set has all the elements and set_destroy returns OK, the memory is released with the arena
+ */
+void test1_set_create_in_arena();
+
+/**
+ * @test Test copying a set that has grown into an arena
+ * @pre A set with MAX_ELEMENTS_IN_SET + 5 Ids, from which ID_1 is deleted after copying it
+ * @post The copy has all the elements in the same order, including ID_1
+ */
+void test1_set_copy_in_arena();
+
+#endif
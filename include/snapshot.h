@@ -0,0 +1,75 @@
+/**
+ * @brief It defines the snapshots, the binary saved games that keep only the state of a game
+ *
+ * @file snapshot.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "types.h"
+#include "game.h"
+
+#define SNAPSHOT_VERSION 2 /*!<Version of the format of the snapshots, snapshots of other versions are rejected*/
+
+/**
+ * @brief Checks if a file is a snapshot
+ * @author agent
+ * @param filename the name of the file
+ * @return TRUE if the file starts like a snapshot, FALSE otherwise
+ */
+Bool snapshot_is_snapshot(char *filename);
+
+/**
+ * @brief Writes the state of a game as a snapshot
+ * @author agent
+ *
+ * The snapshot is made of a header with the version, the size, a checksum and the hash of the world of the game,
+ *  a table with fixed-size records for each kind of entity and a pool with the texts of the interfaces.
+ *  Only what changes while playing is stored (where everything is, health, open links, the progress of the missions,
+ *  the interfaces, the state of the random numbers...), the names, descriptions and graphic descriptions stay in the world the hash refers to.
+ * @param game the game
+ * @param filename the name of the snapshot to be written
+ * @return Status OK or ERROR
+ */
+Status snapshot_save(Game *game, char *filename);
+
+/**
+ * @brief Makes the snapshot of the state of a game in memory, as it would be written by snapshot_save
+ * @author agent
+ *
+ * Only the game is read, so the snapshot can be written afterwards while the game goes on.
+ * @param game the game
+ * @param data where a pointer to the snapshot is left, it must be freed with free
+ * @param size where the number of bytes of the snapshot is left
+ * @return Status OK or ERROR
+ */
+Status snapshot_build(Game *game, char **data, long *size);
+
+/**
+ * @brief Restores the state kept in a snapshot into a game
+ * @author agent
+ *
+ * The snapshot is checked before anything is changed: its version, size and checksum, and that it was saved from
+ *  a game with the same world. If a record is wrong after that, the game is left half restored, so it is usually a copy.
+ * @param game the game, with the same world the snapshot was saved from
+ * @param filename the name of the snapshot
+ * @return Status OK or ERROR if the snapshot can not be read, is corrupted, was saved with another version or architecture or from another world
+ */
+Status snapshot_load(Game *game, char *filename);
+
+/**
+ * @brief Gets the hash of the static content of the world of a game: the ids, names, descriptions and graphic descriptions of its entities, its links, the texts of its missions and its cinematics
+ * @author agent
+ *
+ * It is computed the first time and kept in the game, which shares it with its copies.
+ * @param game the game
+ * @return the hash
+ */
+unsigned long snapshot_world_hash(Game *game);
+
+#endif
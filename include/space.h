@@ -13,9 +13,13 @@
 
 #include "types.h"
 #include "set.h"
+#include "link.h"
+#include "location.h"
+#include "art.h"
 
 #define N_TOTAL_ROWS_IN_SQUARE 58    /*!<Number of lines in one of the space squares*/
 #define N_TOTAL_COLUMNS_IN_SQUARE 152/*!<Number of rows in one of the space squares*/
+#define N_DIRECTIONS 7               /*!<Number of values of Direction, a space keeps the link that leaves it in each of them*/
 
 #define GENERATOR_SPACE 15              /*!<Space id where the generator is at*/
 #define GENERATOR_FLASH_SPACE 150       /*!<Space id where the generator of the flashback is at*/
@@ -51,6 +55,28 @@ typedef struct _Space Space;
  */
 Space *space_create(Id id);
 
+/**
+ * @brief It creates a new space in an arena, along with its sets
+ * @author agent
+ *
+ * @param arena the arena the space is allocated from, or NULL to allocate it on its own like space_create
+ * @param id the identification number for the new space
+ * @return a new space, initialized, which space_destroy does not free if it is in an arena
+ */
+Space *space_create_in_arena(Arena *arena, Id id);
+
+/**
+ * @brief It creates a copy of a space in an arena, with the same objects, characters and discovered state
+ * @author agent
+ *
+ * The copy shares the name and the graphic description of the space. It has no links and no index of locations,
+ *  they are given to it when it is added to a game.
+ * @param arena the arena the copy is allocated from, or NULL to allocate it on its own
+ * @param space a pointer to the space to copy
+ * @return the copy, or NULL in case of error
+ */
+Space *space_copy_in_arena(Arena *arena, Space *space);
+
 /**
  * @brief It destroys a space, freeing the allocated memory
  * @author Profesores PPROG
@@ -203,6 +229,8 @@ int space_get_n_characters(Space *space);
  * @brief It gets the graphical description of the space
  * @author Matteo Artunedo
  *
+ * The rows are shared with every space that has the same description, so they must not be modified.
+ * Two spaces share their description if and only if this function returns the same pointer for both.
  * @param space a pointer to the space
  * @return a pointer to the graphical description of the space
  */
@@ -212,12 +240,23 @@ char **space_get_gdesc(Space *space);
  * @brief It sets the graphical description of the space
  * @author Matteo Artunedo
  *
+ * The rows are looked up in the art store, and only copied if no other space has them already.
  * @param space a pointer to the space
  * @param space_gdescription a double pointer to the incoming graphical description to set
  * @return OK, if everything goes well or ERROR if an error occurred
  */
 Status space_set_gdesc(Space *space, char **space_gdescription);
 
+/**
+ * @brief It gives a space the same graphical description as another one, without looking it up
+ * @author agent
+ *
+ * @param space a pointer to the space
+ * @param source a pointer to the space whose description is shared
+ * @return OK, if everything goes well or ERROR if an error occurred
+ */
+Status space_share_gdesc(Space *space, Space *source);
+
 /**
  * @brief Gets the object Id located in position 'pos' of the array of Id in the set of objects in space
  *
@@ -251,4 +290,43 @@ Status space_set_discovered(Space *space, Bool discovered);
  * @return Bool: whether the space has been discovered or not
  */
 Bool space_get_discovered(Space *space);
+
+/**
+ * @brief Sets the link that leaves a space in a direction
+ *
+ * @author agent
+ * @date 18-10-2026
+ *
+ * The space only keeps a reference to the link, which is still owned by the game.
+ * @param space a pointer to the space
+ * @param direction the direction of the link
+ * @param link a pointer to the link, NULL if the space has no link in that direction
+ * @return OK, if everything goes well or ERROR if an error occurred
+ */
+Status space_set_link(Space *space, Direction direction, Link *link);
+
+/**
+ * @brief Gets the link that leaves a space in a direction
+ *
+ * @author agent
+ * @date 18-10-2026
+ *
+ * @param space a pointer to the space
+ * @param direction the direction of the link
+ * @return a pointer to the link, or NULL if there is no link in that direction or an error occurred
+ */
+Link *space_get_link(Space *space, Direction direction);
+
+/**
+ * @brief Sets the index where the space records the objects that are added to it
+ *
+ * @author agent
+ * @date 18-10-2026
+ *
+ * The objects already in the space are added to the index.
+ * @param space a pointer to the space
+ * @param index a pointer to the index of the places of the objects, it is still owned by the caller
+ * @return OK, if everything goes well or ERROR if an error occurred
+ */
+Status space_set_location_index(Space *space, Location_index *index);
 #endif
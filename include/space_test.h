@@ -268,9 +268,9 @@ void test4_space_delete_character();
 void test1_space_set_of_objects_is_full();
 
 /**
- * @test Test checking if a space with full of objects is full
+ * @test Test checking if a space with MAX_ELEMENTS_IN_SET objects is full
  * @pre Space pointer != NULL
- * @post Output==TRUE
+ * @post Output==FALSE, since the set of objects grows as they are added
  */
 void test2_space_set_of_objects_is_full();
 
@@ -378,4 +378,117 @@ void test2_space_get_n_characters();
  * @post output == 0
  */
 void test3_space_get_n_characters();
+
+/**
+ * @test Test setting the link of a space in a direction
+ * @pre Space pointer != NULL, link pointer != NULL, direction = N
+ * @post Output==OK
+ */
+void test1_space_set_link();
+
+/**
+ * @test Test setting the link of a NULL space
+ * @pre Space pointer == NULL, link pointer != NULL, direction = N
+ * @post Output==ERROR
+ */
+void test2_space_set_link();
+
+/**
+ * @test Test setting the link of a space in an invalid direction
+ * @pre Space pointer != NULL, link pointer != NULL, direction = -1 (invalid)
+ * @post Output==ERROR
+ */
+void test3_space_set_link();
+
+/**
+ * @test Test getting the link of a space in a direction
+ * @pre Space pointer != NULL, link previously set in direction E
+ * @post Output==the link that was set
+ */
+void test1_space_get_link();
+
+/**
+ * @test Test getting the link of a space in a direction without link
+ * @pre Space pointer != NULL, no link set
+ * @post Output==NULL
+ */
+void test2_space_get_link();
+
+/**
+ * @test Test getting the link of a NULL space
+ * @pre Space pointer == NULL
+ * @post Output==NULL
+ */
+void test3_space_get_link();
+
+/**
+ * @test Test setting the index of a space that already has an object
+ * @pre Space pointer != NULL with one object, empty index
+ * @post Output==OK and the index says that the object is in the space
+ */
+void test1_space_set_location_index();
+
+/**
+ * @test Test setting the index of a NULL space
+ * @pre Space pointer == NULL
+ * @post Output==ERROR
+ */
+void test2_space_set_location_index();
+
+/**
+ * @test Test that the objects added to a space are recorded in its index
+ * @pre Space pointer != NULL with an index, an object is added
+ * @post The index says that the object is in the space
+ */
+void test3_space_set_location_index();
+
+/**
+ * @test Test that the objects deleted from a space are no longer in its index
+ * @pre Space pointer != NULL with an index, an object is added and deleted
+ * @post The index says that the object is nowhere
+ */
+void test4_space_set_location_index();
+
+/**
+ * @test Test space creation in an arena
+ * @pre An arena and a space ID
+ * @post Non NULL pointer to space that keeps its objects, space_destroy returns OK and the memory is released with the arena
+ */
+void test1_space_create_in_arena();
+
+/**
+ * @test Test that the graphic description is copied
+ * @pre Two spaces, both given their description from the same rows, which are changed in between
+ * @post Each space keeps the rows it was given
+ */
+void test1_space_set_gdesc();
+
+/**
+ * @test Test that equal graphic descriptions are shared
+ * @pre Two spaces given the same rows
+ * @post space_get_gdesc returns the same pointer for both
+ */
+void test2_space_set_gdesc();
+
+/**
+ * @test Test setting the graphic description with NULL arguments
+ * @pre A NULL space, and a space with a NULL description
+ * @post Output == ERROR in both cases
+ */
+void test3_space_set_gdesc();
+
+/**
+ * @test Test that a shared graphic description outlives the space it came from
+ * @pre A space that shares the description of another one, which is destroyed
+ * @post The description of the first space is still the same
+ */
+void test1_space_share_gdesc();
+
+/**
+ * @test Test copying a space into an arena
+ * @pre A discovered space with a name and an object, which is deleted from it after copying it
+ * @post The copy has the same id, name and discovered state, still has the object and shares the graphic description
+ */
+void test1_space_copy_in_arena();
+
 #endif
@@ -0,0 +1,54 @@
+/**
+ * @brief It defines the pool where the texts of the entities are interned
+ *
+ * @file string_pool.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include "types.h"
+
+#define EMPTY_STRING 0 /*!<Handle of the empty string, which is always in the pool*/
+#define NO_STRING -1   /*!<Value returned instead of a handle when a string cannot be interned*/
+
+/**
+ * @brief Compact reference to a string of the pool
+ * @author agent
+ *
+ * Equal strings are stored once and share the same handle, so two handles can be compared instead of the texts.
+ * The pool is shared by every game of the process and guarded by a lock, so games in different threads can intern and read strings at the same time.
+ */
+typedef int String_handle;
+
+/**
+ * @brief Gets the handle of a string, adding a copy of it to the pool if it is not there yet
+ * @author agent
+ * @param str the string, NULL is taken as the empty string
+ * @return the handle of the string, or NO_STRING if there is no memory to add it
+ */
+String_handle string_pool_intern(const char *str);
+
+/**
+ * @brief Gets the text of a handle
+ * @author agent
+ *
+ * The text is shared by every entity that has it, so it must not be modified. It does not move while the pool is alive.
+ * @param handle the handle
+ * @return the string, the empty string if the handle is not in the pool
+ */
+const char *string_pool_get(String_handle handle);
+
+/**
+ * @brief Frees all the strings of the pool, the handles given before are no longer valid
+ * @author agent
+ *
+ * It must only be called once no game is using the pool any more.
+ */
+void string_pool_release();
+
+#endif
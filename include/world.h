@@ -0,0 +1,52 @@
+/**
+ * @brief It defines the compiled world images, a binary form of the data files that is loaded without parsing it
+ *
+ * @file world.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "types.h"
+#include "game.h"
+
+#define WORLD_VERSION 1                   /*!<Version of the format of the world images, images of other versions are rejected*/
+
+/**
+ * @brief Checks if a file is a compiled world image
+ * @author agent
+ * @param filename the name of the file
+ * @return TRUE if the file starts like a world image, FALSE otherwise
+ */
+Bool world_is_image(char *filename);
+
+/**
+ * @brief Writes the world of a game (spaces, objects, players, characters, links, cinematics and missions) as a world image
+ * @author agent
+ *
+ * The image is made of a header with the version and a checksum, a table with fixed-size records for each kind of entity
+ *  and a pool with all of the strings, where the graphic descriptions are stored already decoded.
+ *  The state of a saved game (turn, interface...) is not part of the image.
+ * @param game the game, usually just loaded from a data file
+ * @param filename the name of the image to be written
+ * @return Status OK or ERROR
+ */
+Status world_compile(Game *game, char *filename);
+
+/**
+ * @brief Loads the world of a world image into a game
+ * @author agent
+ *
+ * The image is mapped in memory and, once its version and checksum have been checked,
+ *  the entities are created straight from its records, without parsing any text.
+ * @param game the game, already created and empty
+ * @param filename the name of the image
+ * @return Status OK or ERROR if the image can not be read, is corrupted or was compiled with another version or architecture
+ */
+Status world_load(Game *game, char *filename);
+
+#endif
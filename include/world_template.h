@@ -0,0 +1,51 @@
+/**
+ * @brief It defines the world a game starts from, loaded once for every game created from it
+ *
+ * @file world_template.h
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef WORLD_TEMPLATE_H
+#define WORLD_TEMPLATE_H
+
+#include "types.h"
+#include "game.h"
+
+/**
+ * @brief World as it is read from a data file or a world image, before anybody plays it
+ * @author agent
+ *
+ * The template is never modified. The texts and graphic descriptions of its entities are shared with the games
+ *  created from it, which only copy the state that changes while playing. The games do not depend on the template,
+ *  so it can be destroyed before them.
+ */
+typedef struct _World_template World_template;
+
+/**
+ * @brief Loads a world from a data file or a world image
+ * @author agent
+ * @param filename the name of the file
+ * @return a pointer to the new template, or NULL in case of error
+ */
+World_template *world_template_create(char *filename);
+
+/**
+ * @brief Frees the memory of a template
+ * @author agent
+ * @param world the template
+ */
+void world_template_destroy(World_template *world);
+
+/**
+ * @brief Creates a game in the initial state of the world
+ * @author agent
+ * @param world the template
+ * @param game a double pointer where the new game is stored
+ * @return Status OK or ERROR
+ */
+Status world_template_new_game(World_template *world, Game **game);
+
+#endif
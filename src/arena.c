@@ -0,0 +1,137 @@
+/**
+ * @brief It implements the arena where the entities of a game are allocated
+ *
+ * @file arena.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "arena.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BLOCK_SIZE 65536 /*!<Number of bytes of each block of the arena, the allocations larger than this get a block of their own*/
+
+/**
+ * @brief Types with the strictest alignment, the blocks and the allocations are aligned as this union
+ * @author agent
+ */
+typedef union
+{
+  long l;        /*!<Alignment of the integers*/
+  double d;      /*!<Alignment of the floating point numbers*/
+  long double x; /*!<Alignment of the long floating point numbers*/
+  void *p;       /*!<Alignment of the pointers*/
+} Alignment;
+
+#define ALIGN(size) (((size) + sizeof(Alignment) - 1) / sizeof(Alignment) * sizeof(Alignment)) /*!<Rounds a size up to a multiple of the alignment*/
+
+/**
+ * @brief Block of memory of an arena, the memory handed out follows the header
+ * @author agent
+ */
+typedef struct _Block
+{
+  struct _Block *next; /*!<Block allocated before this one, NULL for the first one*/
+  size_t size;         /*!<Number of bytes after the header*/
+  size_t used;         /*!<Number of bytes already handed out*/
+} Block;
+
+/**
+ * @brief List of blocks of an arena, the newest first
+ * @author agent
+ */
+struct _Arena
+{
+  Block *blocks; /*!<Block the memory is being handed out from, followed by the older ones*/
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Allocates a new block, filled with zeros
+ * @author agent
+ * @param size the number of bytes after the header
+ * @return a pointer to the block, or NULL in case of error
+ */
+Block *arena_block_create(size_t size);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Arena *arena_create()
+{
+  Arena *arena = NULL;
+
+  if (!(arena = (Arena *)malloc(sizeof(Arena))))
+    return NULL;
+
+  arena->blocks = NULL;
+  return arena;
+}
+
+void arena_destroy(Arena *arena)
+{
+  Block *block = NULL;
+
+  if (!arena)
+    return;
+
+  while ((block = arena->blocks))
+  {
+    arena->blocks = block->next;
+    free(block);
+  }
+  free(arena);
+}
+
+void *arena_alloc(Arena *arena, size_t size)
+{
+  Block *block = NULL;
+  void *memory = NULL;
+
+  if (!arena || size == 0)
+    return NULL;
+
+  size = ALIGN(size);
+  block = arena->blocks;
+  if (!block || block->size - block->used < size)
+  {
+    /*A large allocation goes in a block of its own behind the current one, so the rest of the current block is not wasted*/
+    if (!(block = arena_block_create(size > BLOCK_SIZE ? size : BLOCK_SIZE)))
+      return NULL;
+    if (size > BLOCK_SIZE && arena->blocks)
+    {
+      block->next = arena->blocks->next;
+      arena->blocks->next = block;
+    }
+    else
+    {
+      block->next = arena->blocks;
+      arena->blocks = block;
+    }
+  }
+
+  memory = (char *)block + ALIGN(sizeof(Block)) + block->used;
+  block->used += size;
+  return memory;
+}
+
+Block *arena_block_create(size_t size)
+{
+  Block *block = NULL;
+
+  /*calloc leaves the memory of the block filled with zeros*/
+  if (!(block = (Block *)calloc(1, ALIGN(sizeof(Block)) + size)))
+    return NULL;
+
+  block->next = NULL;
+  block->size = size;
+  block->used = 0;
+  return block;
+}
@@ -0,0 +1,260 @@
+/**
+ * @brief It implements the store of graphic descriptions shared between spaces
+ *
+ * @file art.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "art.h"
+#include "hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define INITIAL_BUCKETS 64      /*!<Number of buckets of the store when it is first used, a power of two*/
+
+/**
+ * @brief Graphic description in the store
+ * @author agent
+ *
+ * The row pointers and the text follow the struct in the same allocation.
+ */
+struct _Art
+{
+  unsigned long hash; /*!<Hash of the rows*/
+  int refs;           /*!<Number of references to the art, it is freed when it drops to 0, read and written under the lock of the store*/
+  int n_rows;         /*!<Number of rows*/
+  char **rows;        /*!<Rows of the art*/
+  Art *next;          /*!<Next art in the same bucket of the store*/
+};
+
+/**
+ * @brief Hash table with every art in use
+ * @author agent
+ */
+typedef struct
+{
+  Art **buckets;  /*!<Chains of the arts with the same bucket*/
+  int n_buckets;  /*!<Number of buckets, a power of two*/
+  int n_arts;     /*!<Number of arts in the store, there are never more than buckets*/
+} Art_store;
+
+static Art_store store = {NULL, 0, 0}; /*!<The store shared by all the games of the process*/
+static pthread_mutex_t store_lock = PTHREAD_MUTEX_INITIALIZER; /*!<Lock of the store and of the references to its arts, the games using it can run in different threads*/
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the length a row has in the store
+ * @author agent
+ * @param row the row, NULL is taken as an empty row
+ * @param row_size the size of the buffer the row used to have
+ * @return the length of the row, at most row_size - 1
+ */
+size_t art_row_length(const char *row, int row_size);
+
+/**
+ * @brief Tells if an art has the given rows
+ * @author agent
+ * @param art the art
+ * @param rows the rows
+ * @param n_rows the number of rows
+ * @param row_size the size of the buffer each row used to have
+ * @return TRUE if the rows are the same
+ */
+Bool art_equals(Art *art, char **rows, int n_rows, int row_size);
+
+/**
+ * @brief Doubles the number of buckets of the store, allocating them the first time, with the lock of the store already taken
+ * @author agent
+ * @return Status OK or ERROR
+ */
+Status art_store_grow();
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Art *art_acquire(char **rows, int n_rows, int row_size)
+{
+  Art *art = NULL;
+  unsigned long hash = HASH_START;
+  size_t length, total = 0;
+  char *text = NULL;
+  int i, bucket;
+
+  if (!rows || n_rows < 0 || row_size < 1)
+    return NULL;
+
+  for (i = 0; i < n_rows; i++)
+  {
+    length = art_row_length(rows[i], row_size);
+    if (length > 0)
+      hash = hash_bytes(hash, rows[i], (long)length);
+    /*The end of each row is hashed too, so moving text between rows changes the hash*/
+    hash = hash_bytes(hash, "", 1);
+    total += length + 1;
+  }
+
+  pthread_mutex_lock(&store_lock);
+  if (store.n_buckets > 0)
+  {
+    for (art = store.buckets[hash & (store.n_buckets - 1)]; art; art = art->next)
+    {
+      if (art->hash == hash && art_equals(art, rows, n_rows, row_size) == TRUE)
+      {
+        art->refs++;
+        pthread_mutex_unlock(&store_lock);
+        return art;
+      }
+    }
+  }
+
+  if ((store.n_arts + 1 > store.n_buckets && art_store_grow() == ERROR) ||
+      !(art = (Art *)malloc(sizeof(Art) + n_rows * sizeof(char *) + total)))
+  {
+    pthread_mutex_unlock(&store_lock);
+    return NULL;
+  }
+  art->hash = hash;
+  art->refs = 1;
+  art->n_rows = n_rows;
+  art->rows = (char **)(art + 1);
+  text = (char *)(art->rows + n_rows);
+  for (i = 0; i < n_rows; i++)
+  {
+    length = art_row_length(rows[i], row_size);
+    if (length > 0)
+      memcpy(text, rows[i], length);
+    text[length] = '\0';
+    art->rows[i] = text;
+    text += length + 1;
+  }
+
+  bucket = (int)(hash & (store.n_buckets - 1));
+  art->next = store.buckets[bucket];
+  store.buckets[bucket] = art;
+  store.n_arts++;
+  pthread_mutex_unlock(&store_lock);
+
+  return art;
+}
+
+Art *art_retain(Art *art)
+{
+  if (!art)
+    return NULL;
+
+  pthread_mutex_lock(&store_lock);
+  art->refs++;
+  pthread_mutex_unlock(&store_lock);
+  return art;
+}
+
+void art_release(Art *art)
+{
+  Art **link = NULL;
+
+  if (!art)
+    return;
+
+  pthread_mutex_lock(&store_lock);
+  if (--art->refs > 0)
+  {
+    pthread_mutex_unlock(&store_lock);
+    return;
+  }
+
+  for (link = &store.buckets[art->hash & (store.n_buckets - 1)]; *link != art; link = &(*link)->next)
+    ;
+  *link = art->next;
+  free(art);
+  store.n_arts--;
+
+  /*The buckets are freed with the last art, so nothing is left once every game is destroyed*/
+  if (store.n_arts == 0)
+  {
+    free(store.buckets);
+    store.buckets = NULL;
+    store.n_buckets = 0;
+  }
+  pthread_mutex_unlock(&store_lock);
+}
+
+char **art_get_rows(Art *art)
+{
+  if (!art)
+    return NULL;
+  return art->rows;
+}
+
+int art_get_refs(Art *art)
+{
+  int refs;
+
+  if (!art)
+    return -1;
+
+  pthread_mutex_lock(&store_lock);
+  refs = art->refs;
+  pthread_mutex_unlock(&store_lock);
+  return refs;
+}
+
+size_t art_row_length(const char *row, int row_size)
+{
+  size_t length;
+
+  if (!row)
+    return 0;
+  length = strlen(row);
+  return length > (size_t)(row_size - 1) ? (size_t)(row_size - 1) : length;
+}
+
+Bool art_equals(Art *art, char **rows, int n_rows, int row_size)
+{
+  size_t length;
+  int i;
+
+  if (art->n_rows != n_rows)
+    return FALSE;
+
+  for (i = 0; i < n_rows; i++)
+  {
+    length = art_row_length(rows[i], row_size);
+    if (strlen(art->rows[i]) != length || (length > 0 && memcmp(art->rows[i], rows[i], length) != 0))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+Status art_store_grow()
+{
+  Art **buckets = NULL, *art = NULL, *next = NULL;
+  int i, bucket, n_buckets = store.n_buckets ? 2 * store.n_buckets : INITIAL_BUCKETS;
+
+  if (!(buckets = (Art **)calloc(n_buckets, sizeof(Art *))))
+    return ERROR;
+
+  for (i = 0; i < store.n_buckets; i++)
+  {
+    for (art = store.buckets[i]; art; art = next)
+    {
+      next = art->next;
+      bucket = (int)(art->hash & (n_buckets - 1));
+      art->next = buckets[bucket];
+      buckets[bucket] = art;
+    }
+  }
+
+  free(store.buckets);
+  store.buckets = buckets;
+  store.n_buckets = n_buckets;
+  return OK;
+}
@@ -9,6 +9,8 @@
  *
  */
 #include "character.h"
+#include "glyph.h"
+#include "string_pool.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -22,30 +24,38 @@
 struct _Character
 {
     Id id;                                 /*!<Id of the character*/
-    char name[WORD_SIZE];                  /*!<a string that contains the name of the character*/
+    String_handle name;                    /*!<handle of the name of the character in the string pool*/
     char gdesc[GDESCTAM];                  /*!<a string that contains the graphic description of the character*/
     char dead_gdesc[GDESCTAM];             /*!<a string that contains the graphic description of the character*/
     int health;                            /*!<the health of the character, an integer*/
     Bool friendly;                         /*!<A bool that sets wether the character is friendly or not*/
-    char message[MAX_MESSAGES][WORD_SIZE]; /*!<a array of strings for the message that a character says*/
+    String_handle message[MAX_MESSAGES];   /*!<handles of the messages that a character says in the string pool*/
     int n_messages;                        /*!<number of messages of a character*/
     int message_turn;                      /*!<the turn of the next message to say*/
     Id following;                          /*!<Id of the player they are following*/
     Id location;                           /*!<Id of the location of the character*/
+    Arena *arena;                          /*!<Arena the character is allocated from, NULL if it is allocated on its own*/
 };
 
 Character *character_create(Id id)
+{
+    return character_create_in_arena(NULL, id);
+}
+
+Character *character_create_in_arena(Arena *arena, Id id)
 {
     Character *newChar = NULL;
-    newChar = (Character *)malloc(sizeof(Character));
+    newChar = arena ? (Character *)arena_alloc(arena, sizeof(Character)) : (Character *)malloc(sizeof(Character));
 
     if (!newChar)
         return NULL;
 
     /*Initialization of a new character*/
+    newChar->arena = arena;
     newChar->id = id;
-    newChar->name[0] = '\0';
+    newChar->name = EMPTY_STRING;
     newChar->gdesc[0] = '\0';
+    newChar->dead_gdesc[0] = '\0';
     newChar->health = NO_HP;
     newChar->friendly = FALSE;
     newChar->n_messages = 0;
@@ -55,12 +65,25 @@ Character *character_create(Id id)
     return newChar;
 }
 
+Character *character_copy_in_arena(Arena *arena, Character *c)
+{
+    Character *copy = NULL;
+
+    if (!c || !(copy = arena ? (Character *)arena_alloc(arena, sizeof(Character)) : (Character *)malloc(sizeof(Character))))
+        return NULL;
+    *copy = *c;
+    copy->arena = arena;
+    return copy;
+}
+
 Status character_destroy(Character *c)
 {
     if (!c)
         return ERROR;
 
-    free(c);
+    /*The memory of a character in an arena is released with the arena*/
+    if (!c->arena)
+        free(c);
     return OK;
 }
 
@@ -74,9 +97,11 @@ Status character_set_id(Character *c, Id id)
 
 Status character_set_name(Character *c, char *name)
 {
-    if (!c)
+    String_handle handle;
+
+    if (!c || (handle = string_pool_intern(name)) == NO_STRING)
         return ERROR;
-    strcpy(c->name, name);
+    c->name = handle;
     return OK;
 }
 
@@ -84,16 +109,15 @@ Status character_set_gdesc(Character *c, char *desc)
 {
     if (!c || !desc)
         return ERROR;
-    strcpy(c->gdesc, desc);
-    return OK;
+    /*The escape sequences are decoded once here so the UTF-8 bytes can be printed directly*/
+    return glyph_decode(c->gdesc, desc, GDESCTAM);
 }
 
 Status character_set_dead_gdesc(Character *c, char *desc)
 {
     if (!c || !desc)
         return ERROR;
-    strcpy(c->dead_gdesc, desc);
-    return OK;
+    return glyph_decode(c->dead_gdesc, desc, GDESCTAM);
 }
 
 Status character_set_health(Character *c, int hp)
@@ -123,7 +147,7 @@ char *character_get_name(Character *c)
 {
     if (!c)
         return NULL;
-    return c->name;
+    return (char *)string_pool_get(c->name);
 }
 
 char *character_get_gdesc(Character *c)
@@ -140,6 +164,7 @@ char *character_get_dead_gdesc(Character *c)
     return c->dead_gdesc;
 }
 
+
 int character_get_health(Character *c)
 {
     if (!c)
@@ -161,7 +186,7 @@ Status character_print(Character *cha)
         return ERROR;
 
     /* 1. Print the id and the name of the character */
-    fprintf(stdout, "--> Character (Id: %ld; Name: %s; gDescription: %s; health: %d)\n", cha->id, cha->name, cha->gdesc, cha->health);
+    fprintf(stdout, "--> Character (Id: %ld; Name: %s; gDescription: %s; health: %d)\n", cha->id, string_pool_get(cha->name), cha->gdesc, cha->health);
     if (cha->friendly == FALSE)
     {
         fprintf(stdout, "\n--> The character is agressive");
@@ -174,7 +199,7 @@ Status character_print(Character *cha)
     fprintf(stdout, "\n");
     for (i = 0; i < cha->n_messages; i++)
     {
-        fprintf(stdout, "\n---> The message %d: %s\n", i, cha->message[i]);
+        fprintf(stdout, "\n---> The message %d: %s\n", i, string_pool_get(cha->message[i]));
     }
     fprintf(stdout, "\n---> The Id of the player they are following: %ld\n", cha->following);
     fprintf(stdout, "\n---> The Id of the space: %ld\n", cha->location);
@@ -218,9 +243,11 @@ Id character_get_location(Character *c)
 
 Status character_add_message(Character *c, char *message)
 {
-    if (!c || !message || (c->message_turn + 1) > MAX_MESSAGES)
+    String_handle handle;
+
+    if (!c || !message || c->n_messages >= MAX_MESSAGES || (handle = string_pool_intern(message)) == NO_STRING)
         return ERROR;
-    strcpy(c->message[c->n_messages], message);
+    c->message[c->n_messages] = handle;
     c->n_messages++;
     return OK;
 }
@@ -229,7 +256,7 @@ char *character_get_message_in_pos(Character *c, int pos)
 {
     if (!c || pos < 0 || pos >= c->n_messages)
         return NULL;
-    return c->message[pos];
+    return (char *)string_pool_get(c->message[pos]);
 }
 
 int character_get_n_messages(Character *character)
@@ -246,6 +273,14 @@ int character_get_message_turn(Character *character)
     return character->message_turn;
 }
 
+Status character_set_message_turn(Character *character, int turn)
+{
+    if (!character || turn < 0 || (turn >= character->n_messages && turn != 0))
+        return ERROR;
+    character->message_turn = turn;
+    return OK;
+}
+
 char *character_chat(Character *character)
 {
     int turn;
@@ -253,5 +288,5 @@ char *character_chat(Character *character)
         return NULL;
     turn = character->message_turn;
     character->message_turn = (character->message_turn + 1) % character->n_messages;
-    return character->message[turn];
+    return (char *)string_pool_get(character->message[turn]);
 }
\ No newline at end of file
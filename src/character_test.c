@@ -12,7 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 48 /*!< Maximum number of tests */
+#define MAX_TESTS 55 /*!< Maximum number of tests */
 
 /**
  * @brief Main function for SPACE unit tests.
@@ -142,6 +142,20 @@ int main(int argc, char **argv)
         test01_character_chat();
     if (all || test == 48)
         test02_character_chat();
+    if (all || test == 49)
+        test03_character_set_dead_gdesc();
+    if (all || test == 50)
+        test01_character_create_in_arena();
+    if (all || test == 51)
+        test03_character_set_name();
+    if (all || test == 52)
+        test03_character_add_message();
+    if (all || test == 53)
+        test01_character_copy_in_arena();
+    if (all || test == 54)
+        test01_character_set_message_turn();
+    if (all || test == 55)
+        test02_character_set_message_turn();
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -479,3 +493,76 @@ void test02_character_chat()
     PRINT_TEST_RESULT(strcmp(character_chat(character), "hola") == 0 && strcmp(character_chat(character), "hello") == 0 && strcmp(character_chat(character), "hola") == 0);
     character_destroy(character);
 }
+
+void test03_character_set_dead_gdesc()
+{
+    Character *c = character_create(5);
+    character_set_gdesc(c, "\\xF0\\x9F\\xA6\\x96");
+    character_set_dead_gdesc(c, "\\xE2\\x98\\xA0");
+    PRINT_TEST_RESULT(strcmp(character_get_gdesc(c), "\xF0\x9F\xA6\x96") == 0 && strcmp(character_get_dead_gdesc(c), "\xE2\x98\xA0") == 0);
+    character_destroy(c);
+}
+
+void test01_character_create_in_arena()
+{
+    Arena *arena = arena_create();
+    Character *c = character_create_in_arena(arena, 1);
+    PRINT_TEST_RESULT(c != NULL && character_get_id(c) == 1 && character_destroy(c) == OK);
+    arena_destroy(arena);
+}
+
+void test03_character_set_name()
+{
+    Character *c1 = character_create(1), *c2 = character_create(2);
+    char name[WORD_SIZE] = "Ant";
+    character_set_name(c1, name);
+    strcpy(name, "Bee");
+    character_set_name(c2, "Ant");
+    PRINT_TEST_RESULT(strcmp(character_get_name(c1), "Ant") == 0 && character_get_name(c1) == character_get_name(c2));
+    character_destroy(c1);
+    character_destroy(c2);
+}
+
+void test03_character_add_message()
+{
+    Character *c = character_create(1);
+    int i;
+    for (i = 0; i < MAX_MESSAGES; i++)
+        character_add_message(c, "Hello");
+    PRINT_TEST_RESULT(character_add_message(c, "Hello") == ERROR && character_get_n_messages(c) == MAX_MESSAGES);
+    character_destroy(c);
+}
+
+void test01_character_copy_in_arena()
+{
+    Arena *arena = arena_create();
+    Character *c = character_create(1), *copy = NULL;
+    character_set_name(c, "Ant");
+    character_add_message(c, "Hello");
+    character_add_message(c, "Bye");
+    character_set_health(c, 4);
+    copy = character_copy_in_arena(arena, c);
+    character_chat(c);
+    character_set_health(c, 1);
+    PRINT_TEST_RESULT(copy != NULL && strcmp(character_get_name(copy), "Ant") == 0 && character_get_health(copy) == 4 && strcmp(character_chat(copy), "Hello") == 0);
+    character_destroy(c);
+    arena_destroy(arena);
+}
+
+void test01_character_set_message_turn()
+{
+    Character *c = character_create(1);
+    character_add_message(c, "Hello");
+    character_add_message(c, "Bye");
+    character_chat(c);
+    PRINT_TEST_RESULT(character_set_message_turn(c, 0) == OK && strcmp(character_chat(c), "Hello") == 0);
+    character_destroy(c);
+}
+
+void test02_character_set_message_turn()
+{
+    Character *c = character_create(1);
+    character_add_message(c, "Hello");
+    PRINT_TEST_RESULT(character_set_message_turn(c, 1) == ERROR && character_set_message_turn(NULL, 0) == ERROR && character_get_message_turn(c) == 0);
+    character_destroy(c);
+}
@@ -9,6 +9,7 @@
  */
 
 #include "cinematics.h"
+#include "string_pool.h"
 
 #define DIFFERENCE_BETWEEN_POS_AND_N_ELEMENTS 1 /*!<This macro is used to take into account the fact that, if an array contains 3 elements, the last position is 2, and therefore any position higher than 2, which is 3-1, is not valid*/
 
@@ -18,25 +19,46 @@
  */
 struct _Cinematics_text
 {
-    char cinematic_text[NUMBER_OF_DIALOG_LINES][DIALOGUE_LINE_LENGTH]; /*!<Two-dinemnsional array that stores the dialog lines for each cinematic*/
+    String_handle cinematic_text[NUMBER_OF_DIALOG_LINES];              /*!<Array that stores the handles in the string pool of the dialog lines for each cinematic*/
     int n_lines;                                                       /*!<Number of dialogue lines in the cinematic*/
+    Arena *arena;                                                      /*!<Arena the structure is allocated from, NULL if it is allocated on its own*/
 };
 
 Cinematics_text *cinematics_text_create()
+{
+    return cinematics_text_create_in_arena(NULL);
+}
+
+Cinematics_text *cinematics_text_create_in_arena(Arena *arena)
 {
     Cinematics_text *ct = NULL;
 
-    if (!(ct = (Cinematics_text *)malloc(sizeof(Cinematics_text))))
+    if (!(ct = arena ? (Cinematics_text *)arena_alloc(arena, sizeof(Cinematics_text)) : (Cinematics_text *)malloc(sizeof(Cinematics_text))))
     {
         return NULL;
     }
+    ct->arena = arena;
     ct->n_lines = 0;
     return ct;
 }
 
+Cinematics_text *cinematics_text_copy_in_arena(Arena *arena, Cinematics_text *ct)
+{
+    Cinematics_text *copy = NULL;
+
+    if (!ct || !(copy = arena ? (Cinematics_text *)arena_alloc(arena, sizeof(Cinematics_text)) : (Cinematics_text *)malloc(sizeof(Cinematics_text))))
+    {
+        return NULL;
+    }
+    *copy = *ct;
+    copy->arena = arena;
+    return copy;
+}
+
 void cinematics_text_destroy(Cinematics_text *ct)
 {
-    if (ct)
+    /*The memory of a structure in an arena is released with the arena*/
+    if (ct && !ct->arena)
     {
         free(ct);
     }
@@ -44,9 +66,11 @@ void cinematics_text_destroy(Cinematics_text *ct)
 
 Status cinematics_text_add_line(Cinematics_text *ct, char *line)
 {
-    if (!ct || !line)
+    String_handle handle;
+
+    if (!ct || !line || ct->n_lines >= NUMBER_OF_DIALOG_LINES || (handle = string_pool_intern(line)) == NO_STRING)
         return ERROR;
-    strcpy(ct->cinematic_text[ct->n_lines], line);
+    ct->cinematic_text[ct->n_lines] = handle;
     ct->n_lines++;
     return OK;
 }
@@ -57,7 +81,7 @@ char *cinematics_get_line(Cinematics_text *ct, int pos)
     {
         return NULL;
     }
-    return ct->cinematic_text[pos];
+    return (char *)string_pool_get(ct->cinematic_text[pos]);
 }
 
 int cinematics_get_n_lines(Cinematics_text *ct)
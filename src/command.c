@@ -16,7 +16,6 @@
 #include <strings.h>
 
 #define CMD_LENGTH 100 /*!<maximum length of commands written by user*/
-#define ARG_LENGTH 50  /*!<maximum length of object names*/
 
 /**
  * @brief Array mapping command strings to their descriptions.
@@ -10,12 +10,18 @@
 
 #include "game.h"
 #include "gameManagement.h"
+#include "world.h"
+#include "name_index.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 
+#define INITIAL_TABLE_SIZE 8               /*!<Number of entities a table of the game has room for the first time it grows*/
+#define SPACE_HASH_MULTIPLIER 2654435761UL /*!<Odd constant the ids are multiplied by to spread them over the index (Knuth's multiplicative hash)*/
+#define N_LAST_COMMANDS 3                  /*!<Number of commands kept in the history of each player*/
+
 /**
  * @brief Private structure that saves the 3 last commands of a player and the messages and descriptions of object they chat with and inspect respectively
  *
@@ -38,25 +44,43 @@ typedef struct _InterfaceData
  */
 struct _Game
 {
-  Object *objects[MAX_OBJECTS];                         /*!<Pointer array to the objects that are present in the game*/
+  Object **objects;                                     /*!<Pointer array to the objects that are present in the game*/
   int n_objects;                                        /*!<Number of objects in the game*/
+  int objects_size;                                     /*!<Number of objects the array has room for*/
+  Object **removed_objects;                             /*!<Objects that have been removed from the game after being used, kept so a snapshot can bring them back*/
+  int n_removed_objects;                                /*!<Number of removed objects*/
+  int removed_objects_size;                             /*!<Number of removed objects the array has room for*/
   Player *players[MAX_PLAYERS];                         /*!<Array of the different players in the game*/
   int n_players;                                        /*!<Number of players in the game*/
   TurnByPlayer turn;                                    /*!<Enumeration value that describes in which turn the game is currently in (the integer corresponds to the position in the array of players of the player whose turn it is to play)*/
-  Space *spaces[MAX_SPACES];                            /*!<Array of Spaces*/
+  Space **spaces;                                       /*!<Array of Spaces*/
   int n_spaces;                                         /*!<Number of spaces in the game*/
-  Character *characters[MAX_CHARACTERS];                /*!<Array of characters in the game*/
+  int spaces_size;                                      /*!<Number of spaces the array has room for*/
+  int *space_index;                                     /*!<Open addressing index from the id of each space to its position in spaces plus one, 0 in the empty slots*/
+  int space_index_size;                                 /*!<Number of slots of the index, a power of two at least twice spaces_size so the probes stay short*/
+  Location_index *locations;                            /*!<Index of the space or backpack where each object is, kept by the spaces and the backpacks of the players*/
+  Name_index *object_names;                             /*!<Index from the name of each object, in any case, to the object*/
+  Name_index *character_names;                          /*!<Index from the name of each character, in any case, to the character*/
+  Name_index *player_names;                             /*!<Index from the name of each player, in any case, to the player*/
+  Arena *arena;                                         /*!<Arena the spaces, objects, characters, links, missions and cinematics of the game are allocated from, released at once in game_destroy*/
+  Character **characters;                               /*!<Array of characters in the game*/
   int n_characters;                                     /*!<Number of characters in the game*/
-  Link *links[MAX_LINKS];                               /*!<Array of links*/
+  int characters_size;                                  /*!<Number of characters the array has room for*/
+  Link **links;                                         /*!<Array of links*/
   int n_links;                                          /*!<Number of links in the game*/
+  int links_size;                                       /*!<Number of links the array has room for*/
   Bool finished;                                        /*!<Boolean that establishes whether the game has ended or not*/
   InterfaceData *playerGraphicInformation[MAX_PLAYERS]; /*!<Array of pointers to InterfaceData for each player, where the command history of the player is strored as well as information related to displayed messages*/
   Bool lights_on;                                       /*!<Boolean that determines if the lights in the house that appears in the game are turned on or off*/
   Cinematics current_cinematic;                         /*!<Value that describes if a cinematic has to be played currently*/
   Cinematics_text *cinematics_text[N_CINEMATICS];       /*!<Array of pointers to the structures that contain the text of each cinematic*/
   Mission_Code current_mission;                         /*!<The current mission at the game*/
-  Mission *missions[MAX_MISSIONS];                      /*!<The array of missions in the game*/
+  Mission **missions;                                   /*!<The array of missions in the game*/
   int n_missions;                                       /*!<The number of missions in the game*/
+  int missions_size;                                    /*!<The number of missions the array has room for*/
+  unsigned long world_hash;                             /*!<Hash of the static content of the world, 0 until a snapshot needs it*/
+  Saver *saver;                                         /*!<Save being written in the background, it is not copied with the game*/
+  Rng *rng;                                             /*!<Generator of the random numbers of the game, seeded with 0 until it is seeded on purpose*/
 };
 /**
    Private functions
@@ -78,6 +102,61 @@ Id game_get_space_id_at(Game *game, int position);
  */
 InterfaceData *game_interface_data_create();
 
+/**
+ * @brief Copies the command history and the texts shown to a player into another InterfaceData
+ * @author agent
+ * @param copy pointer to the InterfaceData written, already created
+ * @param data pointer to the InterfaceData copied
+ * @return Status OK or ERROR
+ */
+Status game_interface_data_copy(InterfaceData *copy, InterfaceData *data);
+
+/**
+ * @brief Gets the slot of the index of spaces where an id is stored, or the empty slot where it would be stored
+ * @author agent
+ *
+ * The search starts in the slot given by the hash of the id and goes on through the following ones (linear probing).
+ * @param game a pointer to the game
+ * @param id the id of the space
+ * @return the position of the slot in space_index
+ */
+int game_space_index_slot(Game *game, Id id);
+
+/**
+ * @brief Gets the link that leaves a space in a direction
+ * @author agent
+ *
+ * The link is taken from the table of links of the space. Only when the origin is not a space of the game
+ *  (a link read before its space) are the links of the game searched.
+ * @param game a pointer to the game
+ * @param origin the id of the space the link leaves
+ * @param direction the direction of the link
+ * @return a pointer to the link, or NULL if there is none
+ */
+Link *game_get_link_from_space(Game *game, Id origin, Direction direction);
+
+/**
+ * @brief Makes room in a table of the game for a number of entities
+ * @author agent
+ *
+ * The size is at least doubled each time, so adding the entities one by one costs a constant time on average.
+ * @param table the table, NULL if it has not been allocated yet
+ * @param size pointer to the number of entities the table has room for, it is updated if the table grows
+ * @param needed the number of entities the table must have room for
+ * @param element_size the size of each element of the table
+ * @return the table, which may have been moved, or NULL if there is not enough memory
+ */
+void *game_table_reserve(void *table, int *size, int needed, size_t element_size);
+
+/**
+ * @brief Makes room for a number of spaces, building the index of spaces again if the array grows
+ * @author agent
+ * @param game a pointer to the game
+ * @param needed the number of spaces the game must have room for
+ * @return Status OK or ERROR
+ */
+Status game_reserve_spaces(Game *game, int needed);
+
 /*End of private functions*/
 
 Status game_create(Game **game)
@@ -88,15 +167,29 @@ Status game_create(Game **game)
   (*game) = (Game *)calloc(1, sizeof(Game));
   if (!(*game))
     return ERROR;
-  for (i = 0; i < MAX_SPACES; i++)
-  {
-    (*game)->spaces[i] = NULL;
+  (*game)->locations = location_index_create();
+  (*game)->object_names = name_index_create();
+  (*game)->character_names = name_index_create();
+  (*game)->player_names = name_index_create();
+  (*game)->arena = arena_create();
+  (*game)->rng = rng_create(0);
+  if (!(*game)->locations || !(*game)->object_names || !(*game)->character_names || !(*game)->player_names || !(*game)->arena || !(*game)->rng)
+  {
+    rng_destroy((*game)->rng);
+    arena_destroy((*game)->arena);
+    location_index_destroy((*game)->locations);
+    name_index_destroy((*game)->object_names);
+    name_index_destroy((*game)->character_names);
+    name_index_destroy((*game)->player_names);
+    free(*game);
+    *game = NULL;
+    return ERROR;
   }
-
-  /*initialize the game */
+  /*initialize the game, the tables are allocated when the first entity is added*/
   (*game)->n_spaces = 0;
   (*game)->n_characters = 0;
   (*game)->n_objects = 0;
+  (*game)->n_removed_objects = 0;
   (*game)->n_links = 0;
   (*game)->n_players = 0;
   (*game)->finished = FALSE;
@@ -104,10 +197,12 @@ Status game_create(Game **game)
   (*game)->current_cinematic = INTRODUCTION;
   for (i = 0; i < N_CINEMATICS; i++)
   {
-    (*game)->cinematics_text[i] = cinematics_text_create();
+    (*game)->cinematics_text[i] = cinematics_text_create_in_arena((*game)->arena);
   }
   (*game)->current_mission = NO_MISSION;
   (*game)->n_missions = 0;
+  (*game)->world_hash = 0;
+  (*game)->saver = NULL;
   return OK;
 }
 
@@ -118,42 +213,122 @@ Status game_create_from_file(Game **game, char *filename)
     return ERROR;
   }
 
-  if (gameManagement_load_spaces((*game), filename) == ERROR)
+  /*Compiled world images are loaded without parsing them, any other file is read as a data file*/
+  if (world_is_image(filename) == TRUE)
   {
-    fprintf(stdout, "Could not load spaces");
-    return ERROR;
+    if (world_load((*game), filename) == ERROR)
+    {
+      return ERROR;
+    }
   }
-  if (gameManagement_load_objects((*game), filename) == ERROR)
+  else if (gameManagement_load_world((*game), filename) == ERROR)
   {
-    fprintf(stdout, "Could not load objects");
     return ERROR;
   }
-  if (gameManagement_load_players((*game), filename) == ERROR)
+
+  return OK;
+}
+
+Status game_create_copy(Game **copy, Game *game)
+{
+  Arena *arena = NULL;
+  Space *space = NULL;
+  Object *object = NULL;
+  Character *character = NULL;
+  Link *link = NULL;
+  Player *player = NULL;
+  Mission *mission = NULL;
+  unsigned long state[RNG_STATE_SIZE];
+  Status status = OK;
+  int i;
+
+  if (!copy || !game || game_create(copy) == ERROR)
   {
-    fprintf(stdout, "Could not load players");
     return ERROR;
   }
-  if (gameManagement_load_characters((*game), filename) == ERROR)
+  arena = (*copy)->arena;
+
+  /*The entities are added in the same order, so the indexes of the copy find the same ones as those of the game*/
+  status = game_reserve(*copy, game->n_spaces, game->n_objects, game->n_characters, game->n_links, game->n_missions);
+  for (i = 0; i < game->n_spaces && status == OK; i++)
   {
-    fprintf(stdout, "Could not load characters");
-    return ERROR;
+    if (!(space = space_copy_in_arena(arena, game->spaces[i])) || (status = game_add_space(*copy, space)) == ERROR)
+    {
+      space_destroy(space);
+      status = ERROR;
+    }
   }
-  if (gameManagement_load_links((*game), filename) == ERROR)
+  for (i = 0; i < game->n_objects && status == OK; i++)
   {
-    fprintf(stdout, "Could not load links");
-    return ERROR;
+    if (!(object = object_copy_in_arena(arena, game->objects[i])))
+      status = ERROR;
+    else
+      status = game_add_object(*copy, object);
   }
-  if (gameManagement_load_cinematics((*game), filename) == ERROR)
+  for (i = 0; i < game->n_removed_objects && status == OK; i++)
   {
-    fprintf(stdout, "Could not load cinematics");
-    return ERROR;
+    if (!(object = object_copy_in_arena(arena, game->removed_objects[i])) || game_add_object(*copy, object) == ERROR || game_remove_object(*copy, object) == FALSE)
+      status = ERROR;
+  }
+  for (i = 0; i < game->n_characters && status == OK; i++)
+  {
+    if (!(character = character_copy_in_arena(arena, game->characters[i])))
+      status = ERROR;
+    else
+      status = game_add_character(*copy, character);
+  }
+  for (i = 0; i < game->n_links && status == OK; i++)
+  {
+    if (!(link = link_copy_in_arena(arena, game->links[i])))
+      status = ERROR;
+    else
+      status = game_add_link(*copy, link);
+  }
+  for (i = 0; i < game->n_missions && status == OK; i++)
+  {
+    if (!(mission = mission_copy_in_arena(arena, game->missions[i])))
+      status = ERROR;
+    else
+      status = game_add_mission(*copy, mission);
+  }
+  for (i = 0; i < N_CINEMATICS && status == OK; i++)
+  {
+    if (!((*copy)->cinematics_text[i] = cinematics_text_copy_in_arena(arena, game->cinematics_text[i])))
+      status = ERROR;
+  }
+  /*The players are added last, the objects in their backpacks are recorded in the index of locations when they are*/
+  for (i = 0; i < game->n_players && status == OK; i++)
+  {
+    if (!(player = player_copy(game->players[i])))
+    {
+      status = ERROR;
+    }
+    else if ((status = game_add_player(*copy, player)) == ERROR)
+    {
+      player_destroy(player);
+    }
+    else
+    {
+      status = game_interface_data_copy((*copy)->playerGraphicInformation[i], game->playerGraphicInformation[i]);
+    }
   }
-  if (gameManagement_load_missions((*game), filename) == ERROR)
+
+  if (status == ERROR)
   {
-    fprintf(stdout, "Could not load misions");
+    game_destroy(*copy);
+    *copy = NULL;
     return ERROR;
   }
 
+  (*copy)->turn = game->turn;
+  (*copy)->finished = game->finished;
+  (*copy)->lights_on = game->lights_on;
+  (*copy)->current_cinematic = game->current_cinematic;
+  (*copy)->current_mission = game->current_mission;
+  (*copy)->world_hash = game->world_hash;
+  /*The copy goes on with the same random numbers*/
+  rng_get_state(game->rng, state);
+  rng_set_state((*copy)->rng, state);
   return OK;
 }
 
@@ -173,6 +348,10 @@ Status game_destroy(Game *game)
     if (game->objects[i])
       object_destroy(game->objects[i]);
   }
+  for (i = 0; i < game->n_removed_objects; i++)
+  {
+    object_destroy(game->removed_objects[i]);
+  }
   for (i = 0; i < game->n_links; i++)
   {
     if (game->links[i])
@@ -203,29 +382,54 @@ Status game_destroy(Game *game)
   {
     mission_destroy(game->missions[i]);
   }
+  location_index_destroy(game->locations);
+  name_index_destroy(game->object_names);
+  name_index_destroy(game->character_names);
+  name_index_destroy(game->player_names);
+  free(game->spaces);
+  free(game->space_index);
+  free(game->objects);
+  free(game->removed_objects);
+  free(game->characters);
+  free(game->links);
+  free(game->missions);
+  /*A save still being written is waited for, so the file is complete when the program ends*/
+  if (game->saver)
+    saver_finish(game->saver);
+  rng_destroy(game->rng);
+  /*The entities of the arena have not been freed one by one, they all go with it*/
+  arena_destroy(game->arena);
   free(game);
 
   return OK;
 }
 
+Arena *game_get_arena(Game *game)
+{
+  if (!game)
+  {
+    return NULL;
+  }
+  return game->arena;
+}
+
 Space *game_get_space(Game *game, Id id)
 {
   int i = 0;
 
-  if (id == NO_ID)
+  if (id == NO_ID || game->n_spaces == 0)
   {
     return NULL;
   }
 
-  for (i = 0; i < game->n_spaces; i++)
+  /*The index holds the position of the space plus one, so an empty slot means that the space does not exist*/
+  i = game->space_index[game_space_index_slot(game, id)];
+  if (i == 0)
   {
-    if (id == space_get_id(game->spaces[i]))
-    {
-      return game->spaces[i];
-    }
+    return NULL;
   }
 
-  return NULL;
+  return game->spaces[i - 1];
 }
 
 int game_get_n_spaces(Game *game)
@@ -285,31 +489,21 @@ Player *game_get_player_in_pos(Game *game, int pos)
 
 Player *game_get_player_from_name(Game *game, char *name)
 {
-  int i;
   if (!game || !name)
     return NULL;
-  for (i = 0; i < game->n_players; i++)
-  {
-    if (!strcasecmp(name, player_get_name(game->players[i])))
-    {
-      return game->players[i];
-    }
-  }
-  return NULL;
+  return (Player *)name_index_find(game->player_names, name);
 }
 
 Id game_get_object_location(Game *game, Id objectId)
 {
-  int i;
+  Id space_id = NO_ID;
 
-  for (i = 0; i < game->n_spaces; i++)
+  /*The spaces and backpacks of the game keep the index up to date, so there is no need to look for the object in them*/
+  if (location_index_get(game->locations, objectId, &space_id) != IN_SPACE)
   {
-    if (space_object_belongs(game->spaces[i], objectId))
-    {
-      return space_get_id(game->spaces[i]);
-    }
+    return NO_ID;
   }
-  return NO_ID;
+  return space_id;
 }
 
 Status game_set_object_location(Game *game, Id id, Id objectId)
@@ -400,9 +594,234 @@ Id game_get_space_id_at(Game *game, int position)
   return space_get_id(game->spaces[position]);
 }
 
+int game_space_index_slot(Game *game, Id id)
+{
+  unsigned long slot;
+
+  slot = ((unsigned long)id * SPACE_HASH_MULTIPLIER) & 0xFFFFFFFFUL;
+  slot = (slot ^ (slot >> 16)) & (game->space_index_size - 1);
+
+  /*The index is never full, since it has more slots than the array of spaces, so the search always stops*/
+  while (game->space_index[slot] != 0 && space_get_id(game->spaces[game->space_index[slot] - 1]) != id)
+  {
+    slot = (slot + 1) & (game->space_index_size - 1);
+  }
+
+  return (int)slot;
+}
+
+void *game_table_reserve(void *table, int *size, int needed, size_t element_size)
+{
+  void *grown = NULL;
+  int new_size = *size;
+
+  if (needed <= *size)
+  {
+    return table;
+  }
+
+  if (new_size < INITIAL_TABLE_SIZE)
+  {
+    new_size = INITIAL_TABLE_SIZE;
+  }
+  while (new_size < needed)
+  {
+    new_size *= 2;
+  }
+
+  if (!(grown = realloc(table, new_size * element_size)))
+  {
+    return NULL;
+  }
+  *size = new_size;
+  return grown;
+}
+
+Status game_reserve_spaces(Game *game, int needed)
+{
+  Space **spaces = NULL;
+  int *space_index = NULL;
+  int i, slot, index_size, spaces_size;
+
+  if (needed <= game->spaces_size)
+  {
+    return OK;
+  }
+
+  /*The sizes are only changed once both tables have grown, otherwise the index could end up with fewer slots than spaces*/
+  spaces_size = game->spaces_size;
+  if (!(spaces = (Space **)game_table_reserve(game->spaces, &spaces_size, needed, sizeof(Space *))))
+  {
+    return ERROR;
+  }
+  game->spaces = spaces;
+
+  for (index_size = 1; index_size < 2 * spaces_size; index_size *= 2)
+    ;
+  if (!(space_index = (int *)calloc(index_size, sizeof(int))))
+  {
+    return ERROR;
+  }
+  free(game->space_index);
+  game->space_index = space_index;
+  game->space_index_size = index_size;
+  game->spaces_size = spaces_size;
+
+  /*The spaces are placed again in their order, so the first of two spaces with the same id is still the one kept*/
+  for (i = 0; i < game->n_spaces; i++)
+  {
+    slot = game_space_index_slot(game, space_get_id(game->spaces[i]));
+    if (game->space_index[slot] == 0)
+    {
+      game->space_index[slot] = i + 1;
+    }
+  }
+
+  return OK;
+}
+
+Status game_reserve(Game *game, int n_spaces, int n_objects, int n_characters, int n_links, int n_missions)
+{
+  Object **objects = NULL;
+  Character **characters = NULL;
+  Link **links = NULL;
+  Mission **missions = NULL;
+
+  if (!game)
+  {
+    return ERROR;
+  }
+
+  if (game_reserve_spaces(game, n_spaces) == ERROR)
+  {
+    return ERROR;
+  }
+  if (n_objects > game->objects_size)
+  {
+    if (!(objects = (Object **)game_table_reserve(game->objects, &game->objects_size, n_objects, sizeof(Object *))))
+      return ERROR;
+    game->objects = objects;
+  }
+  if (n_characters > game->characters_size)
+  {
+    if (!(characters = (Character **)game_table_reserve(game->characters, &game->characters_size, n_characters, sizeof(Character *))))
+      return ERROR;
+    game->characters = characters;
+  }
+  if (n_links > game->links_size)
+  {
+    if (!(links = (Link **)game_table_reserve(game->links, &game->links_size, n_links, sizeof(Link *))))
+      return ERROR;
+    game->links = links;
+  }
+  if (n_missions > game->missions_size)
+  {
+    if (!(missions = (Mission **)game_table_reserve(game->missions, &game->missions_size, n_missions, sizeof(Mission *))))
+      return ERROR;
+    game->missions = missions;
+  }
+
+  return OK;
+}
+
+Status game_clear_placements(Game *game)
+{
+  Space *space = NULL;
+  Player *player = NULL;
+  int i;
+
+  if (!game)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < game->n_spaces; i++)
+  {
+    space = game->spaces[i];
+    while (space_get_num_of_objects(space) > 0)
+    {
+      space_delete_object(space, space_get_object_id_in_pos(space, 0));
+    }
+    while (space_get_n_characters(space) > 0)
+    {
+      space_delete_character(space, space_get_character_in_pos(space, 0));
+    }
+  }
+  for (i = 0; i < game->n_players; i++)
+  {
+    player = game->players[i];
+    while (player_get_num_objects_in_backpack(player) > 0)
+    {
+      player_remove_object_from_backpack(player, player_get_backpack_object_id_at(player, 0));
+    }
+  }
+
+  return OK;
+}
+
+unsigned long game_get_world_hash(Game *game)
+{
+  if (!game)
+    return 0;
+  return game->world_hash;
+}
+
+Status game_set_world_hash(Game *game, unsigned long hash)
+{
+  if (!game)
+    return ERROR;
+  game->world_hash = hash;
+  return OK;
+}
+
+Rng *game_get_rng(Game *game)
+{
+  if (!game)
+    return NULL;
+  return game->rng;
+}
+
+Saver *game_get_saver(Game *game)
+{
+  if (!game)
+    return NULL;
+  return game->saver;
+}
+
+Status game_set_saver(Game *game, Saver *saver)
+{
+  if (!game)
+    return ERROR;
+  game->saver = saver;
+  return OK;
+}
+
+Link *game_get_link_from_space(Game *game, Id origin, Direction direction)
+{
+  Space *space = NULL;
+  int i;
+
+  if ((space = game_get_space(game, origin)))
+  {
+    return space_get_link(space, direction);
+  }
+
+  for (i = 0; i < game->n_links; i++)
+  {
+    if (link_get_origin_id(game->links[i]) == origin && link_get_direction(game->links[i]) == direction)
+    {
+      return game->links[i];
+    }
+  }
+
+  return NULL;
+}
+
 Status game_add_space(Game *game, Space *space)
 {
-  if ((space == NULL) || (game->n_spaces >= MAX_SPACES))
+  int slot;
+
+  if ((space == NULL) || game_reserve_spaces(game, game->n_spaces + 1) == ERROR)
   {
     return ERROR;
   }
@@ -410,12 +829,31 @@ Status game_add_space(Game *game, Space *space)
   game->spaces[game->n_spaces] = space;
   game->n_spaces++;
 
+  /*If two spaces have the same id, the first one is kept in the index, as the search through the array used to find*/
+  slot = game_space_index_slot(game, space_get_id(space));
+  if (game->space_index[slot] == 0)
+  {
+    game->space_index[slot] = game->n_spaces;
+  }
+
+  /*From now on the space records in the index the objects added to it*/
+  space_set_location_index(space, game->locations);
+
   return OK;
 }
 
 Status game_add_object(Game *game, Object *object)
 {
-  if ((object == NULL) || (game->n_objects >= MAX_OBJECTS))
+  Object **objects = NULL;
+
+  if ((object == NULL) || !(objects = (Object **)game_table_reserve(game->objects, &game->objects_size, game->n_objects + 1, sizeof(Object *))))
+  {
+    return ERROR;
+  }
+  game->objects = objects;
+
+  /*If two objects have the same name, the first one is kept in the index, as the search through the array used to find*/
+  if (name_index_add(game->object_names, object_get_name(object), object) == ERROR)
   {
     return ERROR;
   }
@@ -455,7 +893,15 @@ Id game_get_object_id_at(Game *game, int position)
 
 Status game_add_character(Game *game, Character *character)
 {
-  if ((character == NULL) || (game->n_characters >= MAX_CHARACTERS))
+  Character **characters = NULL;
+
+  if ((character == NULL) || !(characters = (Character **)game_table_reserve(game->characters, &game->characters_size, game->n_characters + 1, sizeof(Character *))))
+  {
+    return ERROR;
+  }
+  game->characters = characters;
+
+  if (name_index_add(game->character_names, character_get_name(character), character) == ERROR)
   {
     return ERROR;
   }
@@ -500,19 +946,16 @@ Character *game_get_character(Game *game, Id id)
 
 Id game_get_objectId_from_name(Game *game, char *name)
 {
-  int i;
+  Object *object = NULL;
   if (!game || !name)
   {
     return NO_ID;
   }
-  for (i = 0; i < game->n_objects; i++)
+  if (!(object = (Object *)name_index_find(game->object_names, name)))
   {
-    if (strcasecmp(object_get_name(game->objects[i]), name) == 0)
-    {
-      return object_get_id(game->objects[i]);
-    }
+    return NO_ID;
   }
-  return NO_ID;
+  return object_get_id(object);
 }
 
 char *game_get_message(Game *game, Protagonists player)
@@ -572,19 +1015,11 @@ Id game_get_character_location(Game *game, Id character_id)
 
 Character *game_get_character_from_name(Game *game, char *name)
 {
-  int i;
   if (!game || !name)
   {
     return NULL;
   }
-  for (i = 0; i < game->n_characters; i++)
-  {
-    if (strcasecmp(character_get_name(game->characters[i]), name) == 0)
-    {
-      return game->characters[i];
-    }
-  }
-  return NULL;
+  return (Character *)name_index_find(game->character_names, name);
 }
 
 Status game_move_followers(Game *game, Id new_space_id)
@@ -620,27 +1055,17 @@ Status game_move_followers(Game *game, Id new_space_id)
 }
 
 /**
-This function searches through the array of objects in the game and returns
- * the object that matches the given name. It is used in game_actions_use
+This function looks the given name up in the index of names of the objects and returns
+ * the object that matches it. It is used in game_actions_use
  */
 Object *game_get_object_from_name(Game *game, char *object_name)
 {
-
-  int i = 0;
-
   if (game == NULL || object_name == NULL)
   {
     return NULL;
   }
 
-  for (i = 0; i < game->n_objects; i++)
-  {
-    if (strcasecmp(object_get_name(game->objects[i]), object_name) == 0)
-    {
-      return game->objects[i];
-    }
-  }
-  return NULL;
+  return (Object *)name_index_find(game->object_names, object_name);
 }
 
 /**This function searches for the specified object in the game's object array
@@ -651,11 +1076,18 @@ Bool game_remove_object(Game *game, Object *object)
   int i = 0;
   Id space_id;
   Space *space = NULL;
+  Object **removed = NULL;
 
   if (game == NULL || object == NULL)
   {
     return FALSE;
   }
+  /*The room to keep it is made first, so the object is never lost*/
+  if (!(removed = (Object **)game_table_reserve(game->removed_objects, &game->removed_objects_size, game->n_removed_objects + 1, sizeof(Object *))))
+  {
+    return FALSE;
+  }
+  game->removed_objects = removed;
 
   /* Find the space containing the object */
   space_id = game_get_object_location(game, object_get_id(object));
@@ -663,14 +1095,7 @@ Bool game_remove_object(Game *game, Object *object)
   if (space_id != NO_ID)
   {
     /* Get the space by its ID */
-    for (i = 0; i < game->n_spaces; i++)
-    {
-      if (space_get_id(game->spaces[i]) == space_id)
-      {
-        space = game->spaces[i];
-        break;
-      }
-    }
+    space = game_get_space(game, space_id);
     /* Remove the object from the space */
     if (space != NULL)
     {
@@ -690,20 +1115,71 @@ Bool game_remove_object(Game *game, Object *object)
       game->objects[i] = game->objects[game->n_objects - 1];
       game->objects[game->n_objects - 1] = NULL;
       game->n_objects--;
-      /* Free memory for the object */
-      object_destroy(object);
+
+      /*The name now belongs to the first of the remaining objects that have it, if any*/
+      name_index_remove(game->object_names, object_get_name(object), object);
+      for (i = 0; i < game->n_objects; i++)
+      {
+        if (strcasecmp(object_get_name(game->objects[i]), object_get_name(object)) == 0)
+        {
+          name_index_add(game->object_names, object_get_name(game->objects[i]), game->objects[i]);
+          break;
+        }
+      }
+      /*The object is kept apart, it is destroyed with the game*/
+      game->removed_objects[game->n_removed_objects] = object;
+      game->n_removed_objects++;
 
       return TRUE;
     }
   }
   return FALSE;
 }
+
+int game_get_n_removed_objects(Game *game)
+{
+  if (!game)
+    return -1;
+  return game->n_removed_objects;
+}
+
+Object *game_get_removed_object_in_pos(Game *game, int pos)
+{
+  if (!game || pos < 0 || pos >= game->n_removed_objects)
+    return NULL;
+  return game->removed_objects[pos];
+}
+
+Status game_restore_object(Game *game, Id id)
+{
+  Object *object = NULL;
+  int i;
+
+  if (!game)
+    return ERROR;
+
+  for (i = 0; i < game->n_removed_objects; i++)
+  {
+    if (object_get_id(game->removed_objects[i]) == id)
+    {
+      object = game->removed_objects[i];
+      if (game_add_object(game, object) == ERROR)
+        return ERROR;
+      game->removed_objects[i] = game->removed_objects[game->n_removed_objects - 1];
+      game->n_removed_objects--;
+      return OK;
+    }
+  }
+
+  return ERROR;
+}
 /*LINK RELATED FUNCTIONS*/
 
 Status game_add_link(Game *game, Link *link)
 {
   Direction aux_dir = link_get_direction(link);
   Id aux_id = link_get_origin_id(link);
+  Link **links = NULL;
 
   /* error checking */
   if (!game || !link || game_get_connection(game, aux_id, aux_dir) != NO_ID) /* third condition checks if a link in that space and direction already exists */
@@ -711,18 +1187,46 @@ Status game_add_link(Game *game, Link *link)
     return ERROR;
   }
 
-  /* add link to game's array */
+  /* add link to game's array, making room for it */
+  if (!(links = (Link **)game_table_reserve(game->links, &game->links_size, game->n_links + 1, sizeof(Link *))))
+  {
+    return ERROR;
+  }
+  game->links = links;
   game->links[game->n_links] = link;
   game->n_links++;
 
+  /* the link is also kept by its origin space, indexed by its direction */
+  space_set_link(game_get_space(game, aux_id), aux_dir, link);
+
   /* correct exit */
   return OK;
 }
 
+Status game_place_links(Game *game)
+{
+  Space *space = NULL;
+  int i;
+
+  if (!game)
+    return ERROR;
+
+  /*The links placed by game_add_link are already in the table*/
+  for (i = 0; i < game->n_links; i++)
+  {
+    if ((space = game_get_space(game, link_get_origin_id(game->links[i]))) && !space_get_link(space, link_get_direction(game->links[i])))
+    {
+      space_set_link(space, link_get_direction(game->links[i]), game->links[i]);
+    }
+  }
+
+  return OK;
+}
+
 Id game_get_link_id_at(Game *game, long position)
 {
 
-  if (!game || position < 0)
+  if (!game || position < 0 || position >= game->n_links)
     return NO_ID;
 
   return link_get_id(game->links[position]);
@@ -746,7 +1250,7 @@ Link *game_get_link(Game *game, Id id)
 
 Id game_get_connection(Game *game, Id current_space, Direction link_direction)
 {
-  int i;
+  Link *link = NULL;
 
   /* error checking */
   if (!game || current_space == NO_ID || link_direction == UNKNOWN_DIR)
@@ -755,43 +1259,31 @@ Id game_get_connection(Game *game, Id current_space, Direction link_direction)
   }
 
   /* look for link from the current space pointing in the given direction */
-  for (i = 0; i < game->n_links; i++)
+  if (!(link = game_get_link_from_space(game, current_space, link_direction)))
   {
-    if (link_get_origin_id(game->links[i]) == current_space) /*check this condition first for efficiency, less probable*/
-    {
-      if (link_get_direction(game->links[i]) == link_direction) /*check second condition for matching link*/
-      {
-        return link_get_destination_id(game->links[i]); /*return link destination*/
-      }
-    }
+    /*no matching link found, return NO_ID*/
+    return NO_ID;
   }
 
-  /*no matching link found, return NO_ID*/
-  return NO_ID;
+  return link_get_destination_id(link); /*return link destination*/
 }
 
 Bool game_connection_is_open(Game *game, Id current_space, Direction link_direction)
 {
-  int i;
+  Link *link = NULL;
 
   /* error checking */
   if (!game || current_space == NO_ID || link_direction == UNKNOWN_DIR)
     return FALSE;
 
-  /* look for the link matching input arguments in the game->links array */
-  for (i = 0; i < game->n_links; i++)
+  /* look for the link matching input arguments in the table of links of the space */
+  if (!(link = game_get_link_from_space(game, current_space, link_direction)))
   {
-    if (current_space == link_get_origin_id(game->links[i])) /*check this condition first for efficiency, less probable*/
-    {
-      if (link_direction == link_get_direction(game->links[i])) /*check second condition for matching link*/
-      {
-        return link_get_is_open(game->links[i]);
-      }
-    }
+    /* link not found, return false to prevent undefined behaviour */
+    return FALSE;
   }
 
-  /* link not found, return false to prevent undefined behaviour */
-  return FALSE;
+  return link_get_is_open(link);
 }
 
 int game_get_n_links(Game *game)
@@ -861,8 +1353,14 @@ Status game_add_player(Game *game, Player *player)
     return ERROR;
   }
 
+  if (name_index_add(game->player_names, player_get_name(player), player) == ERROR)
+  {
+    return ERROR;
+  }
+
   game->players[game->n_players] = player;
   game->playerGraphicInformation[game->n_players] = game_interface_data_create();
+  player_set_location_index(player, game->locations);
   game->n_players++;
 
   return OK;
@@ -928,6 +1426,37 @@ Status game_kill_current_player(Game *game)
   return OK;
 }
 
+Status game_interface_data_copy(InterfaceData *copy, InterfaceData *data)
+{
+  Command *commands[N_LAST_COMMANDS], *copied[N_LAST_COMMANDS];
+  int i;
+
+  if (!copy || !data)
+  {
+    return ERROR;
+  }
+
+  commands[0] = data->lastCmd;
+  commands[1] = data->second_to_lastCmd;
+  commands[2] = data->third_to_lastCmd;
+  copied[0] = copy->lastCmd;
+  copied[1] = copy->second_to_lastCmd;
+  copied[2] = copy->third_to_lastCmd;
+  for (i = 0; i < N_LAST_COMMANDS; i++)
+  {
+    command_set_code(copied[i], command_get_code(commands[i]));
+    command_set_argument(copied[i], command_get_argument(commands[i]));
+    command_set_argument2(copied[i], command_get_argument2(commands[i]));
+    command_set_lastcmd_success(copied[i], command_get_lastcmd_success(commands[i]));
+  }
+
+  strcpy(copy->message, data->message);
+  strcpy(copy->description, data->description);
+  strcpy(copy->objective, data->objective);
+  copy->show_message = data->show_message;
+  return OK;
+}
+
 InterfaceData *game_interface_data_create()
 {
   InterfaceData *data = NULL;
@@ -972,6 +1501,21 @@ Status game_interface_data_set_last_command(Game *game, Command *last_cmd)
   return OK;
 }
 
+Command *game_interface_data_take_last_command(Game *game)
+{
+  InterfaceData *data = NULL;
+  Command *last_cmd = NULL, *empty = NULL;
+
+  if (!game || !(data = game->playerGraphicInformation[game->turn]) || !(empty = command_create()))
+    return NULL;
+  last_cmd = data->lastCmd;
+  data->lastCmd = data->second_to_lastCmd;
+  data->second_to_lastCmd = data->third_to_lastCmd;
+  data->third_to_lastCmd = empty;
+
+  return last_cmd;
+}
+
 Command *game_interface_data_get_cmd_in_pos(Game *game, CommandPosition pos)
 {
   if (!game)
@@ -1168,8 +1712,11 @@ Status game_set_current_mission(Game *game, Mission_Code mission)
 
 Status game_add_mission(Game *game, Mission *mission)
 {
-  if (!game || !mission || game->n_missions >= MAX_MISSIONS)
+  Mission **missions = NULL;
+
+  if (!game || !mission || !(missions = (Mission **)game_table_reserve(game->missions, &game->missions_size, game->n_missions + 1, sizeof(Mission *))))
     return ERROR;
+  game->missions = missions;
   game->missions[game->n_missions] = mission;
   game->n_missions++;
   return OK;
@@ -9,6 +9,9 @@
  *
  */
 #include "gameManagement.h"
+#include "reader.h"
+#include "snapshot.h"
+#include "saver.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -18,836 +21,828 @@
 /*Declaration of private functions*/
 
 /**
- * @brief Saves in a file all the information about the objects in the game
+ * @brief Tags that start each record of the data and saved files, in the order of tag_to_str
  * @author Alvaro Inigo
+ */
+typedef enum
+{
+  NO_TAG = -1,           /*!<The line is not the start of a record*/
+  SPACE_TAG,             /*!<#s: a space, followed by the lines of its graphic description unless it shares the one of an earlier space*/
+  OBJECT_TAG,            /*!<#o: an object*/
+  PLAYER_TAG,            /*!<#p: a player*/
+  CHARACTER_TAG,         /*!<#c: a character*/
+  LINK_TAG,              /*!<#l: a link*/
+  CINEMATIC_TAG,         /*!<#cin: a line of a cinematic*/
+  MISSION_TAG,           /*!<#mo: a mission and its objectives*/
+  MISSION_DIALOGUE_TAG,  /*!<#mt: the dialogues of a mission*/
+  TURN_TAG,              /*!<#t: the turn of a saved game*/
+  INTERFACE_TAG,         /*!<#i: the interface of a player in a saved game*/
+  CURRENT_CINEMATIC_TAG, /*!<#ccur: the cinematic playing in a saved game*/
+  CURRENT_MISSION_TAG,   /*!<#mcur: the mission of a saved game*/
+  LIGHT_TAG,             /*!<#light: the state of the lights in a saved game*/
+  COUNT_TAG,             /*!<#n: the number of entities of each kind, to make room for them before reading them*/
+  N_TAGS                 /*!<Number of tags*/
+} Record_tag;
+
+char *tag_to_str[N_TAGS] = {"#s:", "#o:", "#p:", "#c:", "#l:", "#cin:", "#mo:", "#mt:", "#t:", "#i:", "#ccur:", "#mcur:", "#light:", "#n:"}; /*!<Text of each tag, in the order of Record_tag*/
+
+/**
+ * @brief Gets the tag a line of a file starts with, removing it from the line
+ * @author agent
+ * @param line view of the line read from the file
+ * @return Record_tag the tag of the line, NO_TAG if it does not start with any of them
+ */
+Record_tag gameManagement_get_tag(Field *line);
+
+/**
+ * @brief Takes the next field of a line and NULL-terminates it in the file
+ * @author agent
+ * @param line view of the rest of the line
+ * @param separators string with the characters that separate the fields
+ * @return the field, or NULL if there are no fields left
+ */
+char *gameManagement_next_string(Field *line, const char *separators);
+
+/**
+ * @brief Takes the next field of a line and gets the integer written in it
+ * @author agent
+ * @param line view of the rest of the line
+ * @param separators string with the characters that separate the fields
+ * @return the value, 0 if there are no fields left
+ */
+long gameManagement_next_long(Field *line, const char *separators);
+
+/**
+ * @brief Creates a space from a #s: record and the lines of its graphic description, which are read from the file
+ * @author agent
+ *
+ * If the record names an earlier space after the discovered field, no lines are read and the space shares its description.
  * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param fields the record, without the tag
+ * @param reader the reader of the file, placed after the record
  * @return Status OK or ERROR
  */
-Status gameManagement_save_objects(Game *game, FILE *saving_file);
+Status gameManagement_load_space(Game *game, Field fields, Reader *reader);
 
 /**
- * @brief Saves in a file all the information about the players in the game
+ * @brief Creates an object from a #o: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param fields the record, without the tag
+ * @param location pointer to the array where the space of the object is stored, in the position of the object in the game, it grows if needed
+ * @param location_size pointer to the number of spaces the array has room for
  * @return Status OK or ERROR
  */
-Status gameManagement_save_players(Game *game, FILE *saving_file);
+Status gameManagement_load_object(Game *game, Field fields, Id **location, int *location_size);
 
 /**
- * @brief Saves in a file the turn of the game
+ * @brief Makes room in the game for the entities counted in a #n: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param fields the record, without the tag
+ * @param location pointer to the array where the spaces of the objects are stored, it grows to the number of objects
+ * @param location_size pointer to the number of spaces the array has room for
  * @return Status OK or ERROR
  */
-Status gameManagement_save_turn(Game *game, FILE *saving_file);
+Status gameManagement_load_counts(Game *game, Field fields, Id **location, int *location_size);
 
 /**
- * @brief Saves in a file all the information about the spaces in the game
+ * @brief Makes an array of ids grow, at least doubling its size
  * @author Alvaro Inigo
- * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param ids pointer to the array, which may be moved
+ * @param size pointer to the number of ids the array has room for
+ * @param needed the number of ids the array must have room for
  * @return Status OK or ERROR
  */
-Status gameManagement_save_spaces(Game *game, FILE *saving_file);
+Status gameManagement_reserve_ids(Id **ids, int *size, int needed);
 
 /**
- * @brief Saves in a file all the information about the characters in the game
+ * @brief Creates a player from a #p: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_characters(Game *game, FILE *saving_file);
+Status gameManagement_load_player(Game *game, Field fields);
 
 /**
- * @brief Saves in a file all the information about the links in the game
+ * @brief Creates a character from a #c: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_links(Game *game, FILE *saving_file);
+Status gameManagement_load_character(Game *game, Field fields);
 
 /**
- * @brief Saves in a file all the information about the interface in the game
+ * @brief Creates a link from a #l: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file we want to write
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_interface(Game *game, FILE *saving_file);
+Status gameManagement_load_link(Game *game, Field fields);
 
 /**
- * @brief saves all the information related to the missions of the game in a file
+ * @brief Adds a line to a cinematic from a #cin: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file to save the information in
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_missions(Game *game, FILE *saving_file);
+Status gameManagement_load_cinematic(Game *game, Field fields);
 
 /**
- * @brief saves the current mission playing in the game
+ * @brief Creates a mission from a #mo: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file a pointer to the file to save
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_current_mission(Game *game, FILE *saving_file);
+Status gameManagement_load_mission(Game *game, Field fields);
 
 /**
- * @brief saves the information related to the cinematics of the game
+ * @brief Adds the dialogues of a #mt: record to a mission already loaded
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file to save the information into
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_cinematics(Game *game, FILE *saving_file);
+Status gameManagement_load_mission_dialogues(Game *game, Field fields);
 
 /**
- * @brief saves the current cinematic of the game
+ * @brief loads the interface and the commands used by a player from a #i: record of a saved game
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file to save de info
+ * @param fields the record, without the tag
  * @return Status OK or ERROR
  */
-Status gameManagement_save_current_cinematic(Game *game, FILE *saving_file);
+Status gameManagement_load_interface(Game *game, Field fields);
+
+/**
+ * @brief Restores the state of a saved game into a game with the same world, keeping the names, descriptions and
+ * graphic descriptions the game already has
+ * @author agent
+ *
+ * The objects and characters are taken out of the spaces and backpacks and placed again where the file says,
+ * and the state of each record is set on the entity with its id. The texts of the records are not read.
+ * @param game a pointer to the game, which is left half restored if the function fails
+ * @param filename the name of the saved file
+ * @return Status OK, or ERROR if the file can not be read or describes a different world
+ */
+Status gameManagement_restore(Game *game, char *filename);
 
 /**
- * @brief Saves in a file the state of lights in the game
+ * @brief Restores a space from a #s: record, skipping the lines of its graphic description
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param saving_file the file we want to write
- * @return Status OK or ERROR
+ * @param fields the record, without the tag
+ * @param reader the reader of the file, placed after the record
+ * @return Status OK, or ERROR if the game has no space with that id and name
  */
-Status gameManagement_save_lights(Game *game, FILE *saving_file);
+Status gameManagement_restore_space(Game *game, Field fields, Reader *reader);
 
 /**
- * @brief loads the turn of the game when calling to load function
+ * @brief Restores an object from a #o: record and places it in its space
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param filename the name of the file to load the turn
- * @return Status OK or ERROR
+ * @param fields the record, without the tag
+ * @return Status OK, or ERROR if the game has no object with that id and name
  */
-Status gameManagement_load_turn(Game *game, char *filename);
+Status gameManagement_restore_object(Game *game, Field fields);
 
 /**
- * @brief loads the interface and all the commands used in a saved game.
+ * @brief Restores a player and its backpack from a #p: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param filename the name of the file to read
- * @return Status OK or ERROR
+ * @param fields the record, without the tag
+ * @return Status OK, or ERROR if the game has no player with that id and name
  */
-Status gameManagement_load_interface(Game *game, char *filename);
+Status gameManagement_restore_player(Game *game, Field fields);
 
 /**
- * @brief Loads the current cinematic playing in the game
+ * @brief Restores a character from a #c: record and places it in its space, its next message is the first one as in a loaded game
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param filename the name of the file to get the information saved
- * @return Status Ok or ERROR
+ * @param fields the record, without the tag
+ * @return Status OK, or ERROR if the game has no character with that id and name
  */
-Status gameManagement_load_current_cinematic(Game *game, char *filename);
+Status gameManagement_restore_character(Game *game, Field fields);
 
 /**
- * @brief Loads the current mission playing in the game
+ * @brief Restores whether a link is open from a #l: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param filename the name of the file to get the information saved
- * @return Status Ok or ERROR
+ * @param fields the record, without the tag
+ * @return Status OK, or ERROR if the game has no link with that id and name
  */
-Status gameManagement_load_current_mission(Game *game, char *filename);
+Status gameManagement_restore_link(Game *game, Field fields);
 
 /**
- * @brief loads the state of lights in the game
+ * @brief Restores the step and next objective of a mission from a #mo: record
  * @author Alvaro Inigo
  * @param game a pointer to the game
- * @param filename the name of the file to read
- * @return Status OK or ERROR
+ * @param fields the record, without the tag
+ * @param pos the position of the mission in the game, the records are saved in the same order
+ * @return Status OK, or ERROR if the mission in that position has a different code
+ */
+Status gameManagement_restore_mission(Game *game, Field fields, int pos);
+
+/**
+ * @brief Restores the next dialogue of a mission from a #mt: record
+ * @author agent
+ * @param game a pointer to the game
+ * @param fields the record, without the tag
+ * @return Status OK, or ERROR if the game has no mission with that code
  */
-Status gameManagement_load_light(Game *game, char *filename);
+Status gameManagement_restore_mission_dialogues(Game *game, Field fields);
 
 /*End of private functions*/
 
-Status gameManagement_load_spaces(Game *game, char *filename)
+Status gameManagement_load_world(Game *game, char *filename)
 {
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char **read_gdesc;
-  char *toks = NULL;
-  int i, length;
-  Id id;
-  Space *space = NULL;
+  Reader *reader = NULL;
+  Field line, interface[MAX_PLAYERS];
+  Id *object_location = NULL;
+  Record_tag tag;
+  int i, n_interface = 0, location_size = 0;
+  int turn = -1, current_cinematic = -1, current_mission = -1, lights = -1;
   Status status = OK;
-  int discovered;
-  Bool discover;
 
   if (!filename || !game)
   {
     return ERROR;
   }
 
-  if (!(read_gdesc = (char **)calloc(N_TOTAL_ROWS_IN_SQUARE, sizeof(char *))))
+  if (!(reader = reader_open(filename)))
   {
     return ERROR;
   }
-  if (!(read_gdesc[0] = (char *)calloc(N_TOTAL_ROWS_IN_SQUARE * (N_TOTAL_COLUMNS_IN_SQUARE), sizeof(char))))
+
+  /**
+   * reads the file only once, each line is loaded according to the tag it starts with.
+   */
+  while (status == OK && reader_next_line(reader, &line))
+  {
+    switch ((tag = gameManagement_get_tag(&line)))
+    {
+    case SPACE_TAG:
+      status = gameManagement_load_space(game, line, reader);
+      break;
+    case OBJECT_TAG:
+      status = gameManagement_load_object(game, line, &object_location, &location_size);
+      break;
+    case PLAYER_TAG:
+      status = gameManagement_load_player(game, line);
+      break;
+    case CHARACTER_TAG:
+      status = gameManagement_load_character(game, line);
+      break;
+    case LINK_TAG:
+      status = gameManagement_load_link(game, line);
+      break;
+    case CINEMATIC_TAG:
+      status = gameManagement_load_cinematic(game, line);
+      break;
+    case MISSION_TAG:
+      status = gameManagement_load_mission(game, line);
+      break;
+    case MISSION_DIALOGUE_TAG:
+      status = gameManagement_load_mission_dialogues(game, line);
+      break;
+    /*The state of a saved game is applied once the whole world has been read*/
+    case INTERFACE_TAG:
+      if (n_interface < MAX_PLAYERS)
+        interface[n_interface++] = line;
+      break;
+    case TURN_TAG:
+      turn = (int)gameManagement_next_long(&line, "\n\r");
+      break;
+    case CURRENT_CINEMATIC_TAG:
+      current_cinematic = (int)gameManagement_next_long(&line, "|\r\n");
+      break;
+    case CURRENT_MISSION_TAG:
+      current_mission = (int)gameManagement_next_long(&line, "\n\r");
+      break;
+    case LIGHT_TAG:
+      lights = (int)gameManagement_next_long(&line, "\n\r");
+      break;
+    case COUNT_TAG:
+      status = gameManagement_load_counts(game, line, &object_location, &location_size);
+      break;
+    default:
+      break;
+    }
+  }
+
+  if (status == ERROR)
   {
-    free(read_gdesc);
+    free(object_location);
+    reader_close(reader);
     return ERROR;
   }
-  for (i = 1; i < N_TOTAL_ROWS_IN_SQUARE; i++)
+
+  /*The records may reference spaces that appear later in the file, so the objects, characters, players and links are placed once all of them exist*/
+  game_place_links(game);
+  for (i = 0; i < game_get_n_objects(game); i++)
+  {
+    space_add_objectId(game_get_space(game, object_location[i]), object_get_id(game_get_object_in_pos(game, i)));
+  }
+  free(object_location);
+  for (i = 0; i < game_get_n_characters(game); i++)
+  {
+    space_add_character(game_get_space(game, character_get_location(game_get_character_in_pos(game, i))), character_get_id(game_get_character_in_pos(game, i)));
+  }
+  for (i = 0; i < game_get_n_players(game); i++)
+  {
+    space_set_discovered(game_get_space(game, player_get_location(game_get_player_in_pos(game, i))), TRUE);
+  }
+
+  if (game_get_n_spaces(game) == 0)
+  {
+    fprintf(stdout, "Could not load spaces");
+    status = ERROR;
+  }
+  else if (game_get_n_players(game) == 0)
+  {
+    fprintf(stdout, "Could not load players");
+    status = ERROR;
+  }
+  else if (game_get_n_characters(game) == 0)
+  {
+    fprintf(stdout, "Could not load characters");
+    status = ERROR;
+  }
+  else if (game_get_n_links(game) == 0)
   {
-    read_gdesc[i] = read_gdesc[0] + (N_TOTAL_COLUMNS_IN_SQUARE)*i;
+    fprintf(stdout, "Could not load links");
+    status = ERROR;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
+  /*The interface records point inside the file, so they are loaded before closing it*/
+  for (i = 0; i < n_interface && status == OK; i++)
+  {
+    status = gameManagement_load_interface(game, interface[i]);
+  }
+  reader_close(reader);
+  if (status == ERROR)
   {
     return ERROR;
   }
-  /**
-   * reads the file and loads each data individually.
-   */
-  length = strlen("#s:");
 
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
+  if (turn != -1 && game_set_turn(game, turn) == ERROR)
+  {
+    return ERROR;
+  }
+  if (current_cinematic != -1)
+  {
+    game_set_current_cinematic(game, current_cinematic);
+  }
+  if (current_mission != -1 && game_set_current_mission(game, current_mission) == ERROR)
   {
+    return ERROR;
+  }
+  if (lights != -1 && game_set_lights_on(game, lights == 1 ? TRUE : FALSE) == ERROR)
+  {
+    return ERROR;
+  }
 
-    if (strncmp("#s:", line, length) == 0)
-    {
-      toks = strtok(line + length, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|");
-      discovered = atoi(toks);
-
-      for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
-      {
-        fgets(line, WORD_SIZE, file);
-        /*In case there is a \n at the end of the line, we remove it*/
-        toks = strtok(line, "\n");
-        if (toks)
-        {
-          strncpy(read_gdesc[i], toks, N_TOTAL_COLUMNS_IN_SQUARE - 1);
-        }
-        /*If there is no \n character, we save it normally*/
-        else
-        {
-          strncpy(read_gdesc[i], line, N_TOTAL_COLUMNS_IN_SQUARE - 1);
-        }
-        read_gdesc[i][N_TOTAL_COLUMNS_IN_SQUARE - 1] = '\0';
-      }
+  return OK;
+}
 
-#ifdef DEBUG
+Record_tag gameManagement_get_tag(Field *line)
+{
+  char *end = NULL;
+  int i, length;
 
-#endif
-      /*
-       * It creates the space with the data that has been read
-       */
-      space = space_create(id); /*calls to space_create providing the id written in the file*/
-      if (space != NULL)
-      { /*Sets the information related to the space and adds it to the game*/
-        space_set_name(space, name);
-        game_add_space(game, space);
-        space_set_gdesc(space, read_gdesc);
-        discover = discovered == 1 ? TRUE : FALSE;
-        space_set_discovered(space, discover);
-      }
-      else
-      {
-        fclose(file);
-        free(read_gdesc[0]);
-        free(read_gdesc);
-        return ERROR;
-      }
-    }
-  }
-  free(read_gdesc[0]);
-  free(read_gdesc);
-  if (ferror(file) || space == NULL)
+  if (!line || line->len == 0 || line->str[0] != '#' || !(end = (char *)memchr(line->str, ':', line->len)))
+    return NO_TAG;
+
+  length = end - line->str + 1;
+  for (i = 0; i < N_TAGS; i++)
   {
-    status = ERROR;
+    if ((int)strlen(tag_to_str[i]) == length && strncmp(tag_to_str[i], line->str, length) == 0)
+    {
+      /*The tag is removed from the line*/
+      line->str += length;
+      line->len -= length;
+      return (Record_tag)i;
+    }
   }
 
-  fclose(file);
+  return NO_TAG;
+}
 
-  return status;
+char *gameManagement_next_string(Field *line, const char *separators)
+{
+  Field field;
+
+  if (!field_next(line, separators, &field))
+    return NULL;
+
+  return field_terminate(&field);
 }
 
-Status gameManagement_load_objects(Game *game, char *filename)
+long gameManagement_next_long(Field *line, const char *separators)
 {
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char gdesc[GDESCTAM] = "";
-  char description[WORD_SIZE] = "";
-  char *toks = NULL;
-  Id id = NO_ID, spaceId = NO_ID, dependency = NO_ID, open = NO_ID;
-  Object *object = NULL;
-  Status status = OK;
-  int movable = 1, health = 0, length;
+  Field field;
 
-  if (!filename || !game)
-  {
-    return ERROR;
-  }
+  if (!field_next(line, separators, &field))
+    return 0;
+
+  return field_to_long(field);
+}
 
-  file = fopen(filename, "r");
-  if (file == NULL)
+Status gameManagement_load_space(Game *game, Field fields, Reader *reader)
+{
+  char *gdesc[N_TOTAL_ROWS_IN_SQUARE], blank[] = "";
+  char *name = NULL;
+  Field line;
+  int i, discovered;
+  Id id, art_id;
+  Space *space = NULL, *art_space = NULL;
+
+  id = gameManagement_next_long(&fields, "|");
+  name = gameManagement_next_string(&fields, "|");
+  discovered = (int)gameManagement_next_long(&fields, "|");
+  art_id = gameManagement_next_long(&fields, "|");
+
+  /*A space with the same graphic description as an earlier one names it instead of repeating its lines*/
+  if (art_id != 0 && !(art_space = game_get_space(game, art_id)))
   {
     return ERROR;
   }
-  /**
-   * reads the file and loads each data individually.
-   */
 
-  length = strlen("#o:");
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
+  /*The rows of the graphic description are the lines that follow the record, they are used from the file without copying them*/
+  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE && !art_space; i++)
   {
-    if (strncmp("#o:", line, length) == 0)
+    if (reader_next_line(reader, &line))
     {
-      toks = strtok(line + length, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(gdesc, toks);
-      toks = strtok(NULL, "|");
-      spaceId = atol(toks);
-      toks = strtok(NULL, "|\n\r");
-      strcpy(description, toks);
-      toks = strtok(NULL, "|\n\r");
-      movable = atoi(toks);
-      toks = strtok(NULL, "|\n\r");
-      health = atoi(toks);
-      toks = strtok(NULL, "|\n\r");
-      dependency = atol(toks);
-      toks = strtok(NULL, "|\n\r");
-      open = atol(toks);
-
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%ld|%s|%d|%d|%ld|%ld|\n", id, name, spaceId, description, movable, health, dependency, open);
-#endif
-      /*
-       * It creates the space with the data that has been read
-       */
-      object = object_create(id); /*calls to object_create providing the id written in the file*/
-      if (object != NULL)
-      { /*Sets the information related to the object and adds it to the game*/
-        object_set_name(object, name);
-        object_set_gdesc(object, gdesc);
-        object_set_description(object, description);
-        object_set_movable(object, movable == 1 ? TRUE : FALSE);
-        object_set_health(object, health);
-        object_set_dependency(object, dependency);
-        object_set_open(object, open);
-        space_add_objectId(game_get_space(game, spaceId), id);
-        game_add_object(game, object);
-      }
-      if (object == NULL)
-        return ERROR;
+      if (line.len > N_TOTAL_COLUMNS_IN_SQUARE - 1)
+        line.len = N_TOTAL_COLUMNS_IN_SQUARE - 1;
+      gdesc[i] = field_terminate(&line);
+    }
+    else
+    {
+      gdesc[i] = blank;
     }
   }
 
-  if (ferror(file))
+  /*
+   * It creates the space with the data that has been read
+   */
+  space = space_create_in_arena(game_get_arena(game), id); /*calls to space_create_in_arena providing the id written in the file*/
+  if (space == NULL)
   {
-    status = ERROR;
+    return ERROR;
   }
+  /*Sets the information related to the space and adds it to the game*/
+  space_set_name(space, name);
+  game_add_space(game, space);
+  if (art_space)
+  {
+    space_share_gdesc(space, art_space);
+  }
+  else
+  {
+    space_set_gdesc(space, gdesc);
+  }
+  space_set_discovered(space, discovered == 1 ? TRUE : FALSE);
 
-  fclose(file);
-
-  return status;
+  return OK;
 }
 
-Status gameManagement_load_players(Game *game, char *filename)
+Status gameManagement_load_object(Game *game, Field fields, Id **location, int *location_size)
 {
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char gdesc[GDESCTAM] = "";
-  char *toks = NULL;
-  Id id = NO_ID, spaceId = NO_ID, objectId = NO_ID, teamId = NO_ID;
-  Player *player = NULL;
-  Status status = OK;
-  int hp = 0, length;
-  int inventory_size = 0;
+  char *name = NULL, *gdesc = NULL, *description = NULL;
+  Id id = NO_ID, spaceId = NO_ID, dependency = NO_ID, open = NO_ID;
+  Object *object = NULL;
+  int movable = 1, health = 0;
+
+  id = gameManagement_next_long(&fields, "|");
+  name = gameManagement_next_string(&fields, "|");
+  gdesc = gameManagement_next_string(&fields, "|\r\n");
+  spaceId = gameManagement_next_long(&fields, "|");
+  description = gameManagement_next_string(&fields, "|\n\r");
+  movable = (int)gameManagement_next_long(&fields, "|\n\r");
+  health = (int)gameManagement_next_long(&fields, "|\n\r");
+  dependency = gameManagement_next_long(&fields, "|\n\r");
+  open = gameManagement_next_long(&fields, "|\n\r");
 
-  if (!filename || !game)
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%ld|%s|%d|%d|%ld|%ld|\n", id, name, spaceId, description, movable, health, dependency, open);
+#endif
+  /*
+   * It creates the object with the data that has been read
+   */
+  if (gameManagement_reserve_ids(location, location_size, game_get_n_objects(game) + 1) == ERROR)
   {
     return ERROR;
   }
-
-  file = fopen(filename, "r");
-  if (file == NULL)
+  object = object_create_in_arena(game_get_arena(game), id); /*calls to object_create_in_arena providing the id written in the file*/
+  if (object == NULL)
   {
     return ERROR;
   }
-  /**
-   * reads the file and loads each data individually.
-   */
-  length = strlen("#p:");
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
-  {
-    if (strncmp("#p:", line, length) == 0)
-    {
-      toks = strtok(line + length, "|\r\n");
-      id = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(gdesc, toks);
-      toks = strtok(NULL, "|\r\n");
-      spaceId = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      hp = atoi(toks);
-      toks = strtok(NULL, "|\n\r");
-      inventory_size = atoi(toks);
-      toks = strtok(NULL, "|\n\r");
-      if (toks)
-        teamId = atol(toks);
+  /*Sets the information related to the object and adds it to the game*/
+  object_set_name(object, name);
+  object_set_gdesc(object, gdesc);
+  object_set_description(object, description);
+  object_set_movable(object, movable == 1 ? TRUE : FALSE);
+  object_set_health(object, health);
+  object_set_dependency(object, dependency);
+  object_set_open(object, open);
+  if (game_add_object(game, object) == ERROR)
+  {
+    object_destroy(object);
+    return ERROR;
+  }
+  /*The object is placed in its space once all the spaces have been read*/
+  (*location)[game_get_n_objects(game) - 1] = spaceId;
 
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%s|%ld|%d|%d|%ld|\n", id, name, gdesc, spaceId, hp, inventory_size, teamId);
-#endif
+  return OK;
+}
 
-      /*
-       * It creates the player with the data that has been read
-       */
-      player = player_create(id, inventory_size); /*calls to player_create providing the id written in the file*/
-      if (player != NULL)
-      { /*Sets the information related to the object and adds it to the game*/
-        player_set_name(player, name);
-        player_set_gdesc(player, gdesc);
-        player_set_location(player, spaceId);
-        space_set_discovered(game_get_space(game, spaceId), TRUE);
-        player_set_health(player, hp);
-        while ((toks = strtok(NULL, "|\n\r")))
-        {
-          objectId = atol(toks);
-          player_add_object_to_backpack(player, objectId);
-        }
-        if (teamId != NO_ID)
-          player_set_team(player, teamId);
-        ;
-
-        game_add_player(game, player);
-      }
-    }
-  }
+Status gameManagement_load_counts(Game *game, Field fields, Id **location, int *location_size)
+{
+  int n_spaces, n_objects, n_characters, n_links, n_missions;
 
-  if (ferror(file) || !player)
+  n_spaces = (int)gameManagement_next_long(&fields, "|");
+  n_objects = (int)gameManagement_next_long(&fields, "|");
+  n_characters = (int)gameManagement_next_long(&fields, "|");
+  n_links = (int)gameManagement_next_long(&fields, "|");
+  n_missions = (int)gameManagement_next_long(&fields, "|\n\r");
+
+  /*The counts are only a hint, the tables keep growing if the file has more records*/
+  if (gameManagement_reserve_ids(location, location_size, n_objects) == ERROR)
   {
-    status = ERROR;
+    return ERROR;
   }
-
-  fclose(file);
-
-  return status;
+  return game_reserve(game, n_spaces, n_objects, n_characters, n_links, n_missions);
 }
 
-Status gameManagement_load_characters(Game *game, char *filename)
+Status gameManagement_reserve_ids(Id **ids, int *size, int needed)
 {
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char gdesc[GDESCTAM] = "", dead_gdesc[GDESCTAM] = "";
-  char message[WORD_SIZE] = "";
-  char *toks = NULL;
-  Id id = NO_ID, spaceId = NO_ID, following = NO_ID;
-  Character *character = NULL;
-  Status status = OK;
-  int hp = 0, length;
-  Bool friendliness = FALSE;
+  Id *grown = NULL;
+  int new_size;
 
-  if (!filename || !game)
+  if (needed <= *size)
   {
-    return ERROR;
+    return OK;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
+  new_size = needed > 2 * (*size) ? needed : 2 * (*size);
+  if (!(grown = (Id *)realloc(*ids, new_size * sizeof(Id))))
   {
     return ERROR;
   }
-  /**
-   * reads the file and loads each data individually.
-   */
-  length = strlen("#c:");
+  *ids = grown;
+  *size = new_size;
+  return OK;
+}
 
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
-  {
-    if (strncmp("#c:", line, length) == 0)
-    {
-      toks = strtok(line + length, "|\r\n");
-      id = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(gdesc, toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(dead_gdesc, toks);
-      toks = strtok(NULL, "|\r\n");
-      spaceId = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      hp = atoi(toks);
-      toks = strtok(NULL, "|\r\n");
-      friendliness = atoi(toks);
-      toks = strtok(NULL, "|\r");
-      following = atol(toks);
+Status gameManagement_load_player(Game *game, Field fields)
+{
+  char *name = NULL, *gdesc = NULL;
+  Field field;
+  Id id = NO_ID, spaceId = NO_ID, teamId = NO_ID;
+  Player *player = NULL;
+  int hp = 0;
+  int inventory_size = 0;
+
+  id = gameManagement_next_long(&fields, "|\r\n");
+  name = gameManagement_next_string(&fields, "|\r\n");
+  gdesc = gameManagement_next_string(&fields, "|\r\n");
+  spaceId = gameManagement_next_long(&fields, "|\r\n");
+  hp = (int)gameManagement_next_long(&fields, "|\r\n");
+  inventory_size = (int)gameManagement_next_long(&fields, "|\n\r");
+  if (field_next(&fields, "|\n\r", &field))
+    teamId = field_to_long(field);
 
 #ifdef DEBUG
-      printf("Leido: %ld|%s|%s|%ld|%d|%d|%ld|\n", id, name, gdesc, spaceId, hp, friendliness, following);
+  printf("Leido: %ld|%s|%s|%ld|%d|%d|%ld|\n", id, name, gdesc, spaceId, hp, inventory_size, teamId);
 #endif
 
-      /*
-       * It creates the character with the data that has been read
-       */
-      character = character_create(id); /*calls to character_create providing the id written in the file*/
-      if (character != NULL)
-      { /*Sets the information related to the character and adds it to the game*/
-        character_set_name(character, name);
-        character_set_gdesc(character, gdesc);
-        character_set_dead_gdesc(character, dead_gdesc);
-        space_add_character(game_get_space(game, spaceId), id);
-        character_set_location(character, spaceId);
-        character_set_health(character, hp);
-        character_set_friendly(character, friendliness);
-        character_set_following(character, following);
-        while ((toks = strtok(NULL, "|\n\r")))
-        {
-          strcpy(message, toks);
-          character_add_message(character, message);
-        }
-        game_add_character(game, character);
-      }
+  /*
+   * It creates the player with the data that has been read
+   */
+  player = player_create(id, inventory_size); /*calls to player_create providing the id written in the file*/
+  if (player != NULL)
+  { /*Sets the information related to the player and adds it to the game, its space is discovered once all the spaces have been read*/
+    player_set_name(player, name);
+    player_set_gdesc(player, gdesc);
+    player_set_location(player, spaceId);
+    player_set_health(player, hp);
+    /*The rest of the fields are the objects in the backpack*/
+    while (field_next(&fields, "|\n\r", &field))
+    {
+      player_add_object_to_backpack(player, field_to_long(field));
     }
-  }
+    if (teamId != NO_ID)
+      player_set_team(player, teamId);
 
-  if (ferror(file) || character == NULL)
-  {
-    status = ERROR;
+    game_add_player(game, player);
   }
 
-  fclose(file);
+  return OK;
+}
 
-  return status;
+Status gameManagement_load_character(Game *game, Field fields)
+{
+  char *name = NULL, *gdesc = NULL, *dead_gdesc = NULL, *message = NULL;
+  Id id = NO_ID, spaceId = NO_ID, following = NO_ID;
+  Character *character = NULL;
+  int hp = 0;
+  Bool friendliness = FALSE;
+
+  id = gameManagement_next_long(&fields, "|\r\n");
+  name = gameManagement_next_string(&fields, "|\r\n");
+  gdesc = gameManagement_next_string(&fields, "|\r\n");
+  dead_gdesc = gameManagement_next_string(&fields, "|\r\n");
+  spaceId = gameManagement_next_long(&fields, "|\r\n");
+  hp = (int)gameManagement_next_long(&fields, "|\r\n");
+  friendliness = (Bool)gameManagement_next_long(&fields, "|\r\n");
+  following = gameManagement_next_long(&fields, "|\r");
+
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%s|%ld|%d|%d|%ld|\n", id, name, gdesc, spaceId, hp, friendliness, following);
+#endif
+
+  /*
+   * It creates the character with the data that has been read
+   */
+  character = character_create_in_arena(game_get_arena(game), id); /*calls to character_create_in_arena providing the id written in the file*/
+  if (character != NULL)
+  { /*Sets the information related to the character and adds it to the game, it is placed in its space once all the spaces have been read*/
+    character_set_name(character, name);
+    character_set_gdesc(character, gdesc);
+    character_set_dead_gdesc(character, dead_gdesc);
+    character_set_location(character, spaceId);
+    character_set_health(character, hp);
+    character_set_friendly(character, friendliness);
+    character_set_following(character, following);
+    while ((message = gameManagement_next_string(&fields, "|\n\r")))
+    {
+      character_add_message(character, message);
+    }
+    game_add_character(game, character);
+  }
+
+  return OK;
 }
 
-Status gameManagement_load_links(Game *game, char *filename)
+Status gameManagement_load_link(Game *game, Field fields)
 {
-  FILE *file = NULL;
-  Status status = OK;
-  char line[WORD_SIZE] = "";
-  char *toks = NULL;
   Link *link = NULL;
   Id id = NO_ID;
-  char name[WORD_SIZE] = "";
+  char *name = NULL;
   Id idOrigin = NO_ID, idDest = NO_ID;
   Direction direccion = UNKNOWN_DIR;
   Bool open = FALSE;
-  int length;
-
-  if (!filename || !game)
-  {
-    return ERROR;
-  }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
-  {
-    return ERROR;
-  }
-  /**
-   * reads the file and loads each data individually.
-   */
-  length = strlen("#l:");
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
-  {
-    if (strncmp("#l:", line, length) == 0)
-    {
-      toks = strtok(line + length, "|\r\n");
-      id = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|\r\n");
-      idOrigin = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      idDest = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      direccion = atol(toks);
-      toks = strtok(NULL, "|\r\n");
-      open = atol(toks);
+  id = gameManagement_next_long(&fields, "|\r\n");
+  name = gameManagement_next_string(&fields, "|\r\n");
+  idOrigin = gameManagement_next_long(&fields, "|\r\n");
+  idDest = gameManagement_next_long(&fields, "|\r\n");
+  direccion = (Direction)gameManagement_next_long(&fields, "|\r\n");
+  open = (Bool)gameManagement_next_long(&fields, "|\r\n");
 
 #ifdef DEBUG
-      printf("Leido: %ld|%s|%ld|%ld|%d|%d|\n", id, name, idOrigin, idDest, direccion, open);
+  printf("Leido: %ld|%s|%ld|%ld|%d|%d|\n", id, name, idOrigin, idDest, direccion, open);
 #endif
 
-      /*
-       * It creates the link with the data that has been read
-       */
-      link = link_create(id); /*calls to link_create providing the id written in the file*/
-      if (link != NULL)
-      { /*Sets the information related to the link and adds it to the game*/
-        link_set_name(link, name);
-        link_set_origin_id(link, idOrigin);
-        link_set_destination_id(link, idDest);
-        link_set_direction(link, direccion);
-        link_set_is_open(link, open);
-        if (game_add_link(game, link) == ERROR)
-        {
-          printf("error en la carga del link con id: %ld", id);
-          link_destroy(link);
-          fclose(file);
-          return ERROR;
-        }
-      }
+  /*
+   * It creates the link with the data that has been read
+   */
+  link = link_create_in_arena(game_get_arena(game), id); /*calls to link_create_in_arena providing the id written in the file*/
+  if (link != NULL)
+  { /*Sets the information related to the link and adds it to the game*/
+    link_set_name(link, name);
+    link_set_origin_id(link, idOrigin);
+    link_set_destination_id(link, idDest);
+    link_set_direction(link, direccion);
+    link_set_is_open(link, open);
+    if (game_add_link(game, link) == ERROR)
+    {
+      printf("error en la carga del link con id: %ld", id);
+      link_destroy(link);
+      return ERROR;
     }
   }
 
-  if (ferror(file) || !link)
+  return OK;
+}
+
+Status gameManagement_load_cinematic(Game *game, Field fields)
+{
+  Field text;
+  int i;
+
+  i = (int)gameManagement_next_long(&fields, "|\r\n");
+  game_set_current_cinematic(game, i);
+  if (field_next(&fields, "|\r\n", &text))
   {
-    status = ERROR;
+    /*The lines of the cinematics can not be longer than DIALOGUE_LINE_LENGTH*/
+    if (text.len > DIALOGUE_LINE_LENGTH - 1)
+      text.len = DIALOGUE_LINE_LENGTH - 1;
+    cinematics_text_add_line(game_get_current_cinematic_text(game), field_terminate(&text));
   }
 
-  fclose(file);
-
-  return status;
+  return OK;
 }
 
-Status gameManagement_load_cinematics(Game *game, char *filename)
+Status gameManagement_load_mission(Game *game, Field fields)
 {
-  FILE *file = NULL;
-  Status status = OK;
-  char line[DIALOGUE_LINE_LENGTH] = "";
-  char *toks = NULL;
-  int i, start_len;
+  char *objective = NULL;
+  Mission *mission = NULL;
 
-  if (!filename || !game)
+  mission = mission_create_in_arena(game_get_arena(game));
+  if (!mission)
   {
     return ERROR;
   }
+  mission_set_code(mission, (Mission_Code)gameManagement_next_long(&fields, "|\r\n"));
+  mission_set_current_step(mission, (int)gameManagement_next_long(&fields, "|\r\n"));
+  mission_set_next_objective(mission, (int)gameManagement_next_long(&fields, "|\r\n"));
 
-  file = fopen(filename, "r");
-  if (file == NULL)
-  {
-    return ERROR;
-  }
-  /**
-   * reads the file and loads each data individually.
-   */
-  start_len = (int)strlen("#cin:");
-  while (fgets(line, DIALOGUE_LINE_LENGTH, file)) /*Reads all the lines in the text file and saves the provided information*/
+  while ((objective = gameManagement_next_string(&fields, "|\n\r")))
   {
-    if (strncmp("#cin:", line, start_len) == 0)
-    {
-      toks = strtok(line + start_len, "|\r\n");
-      i = atoi(toks);
-      toks = strtok(NULL, "|\r\n");
-      game_set_current_cinematic(game, i);
-      if (toks)
-      {
-        cinematics_text_add_line(game_get_current_cinematic_text(game), toks);
-      }
-
-#ifdef DEBUG
-      printf("Leido: #cin%ld|%s\n", i, toks);
-#endif
-    }
+    mission_add_objective(mission, objective);
   }
-  if (ferror(file))
+  if (!game_add_mission(game, mission))
   {
-
-    status = ERROR;
+    mission_destroy(mission);
+    return ERROR;
   }
 
-  fclose(file);
-  return status;
+  return OK;
 }
 
-Status gameManagement_load_missions(Game *game, char *filename)
+Status gameManagement_load_mission_dialogues(Game *game, Field fields)
 {
-  FILE *file = NULL;
-  Status status = OK;
-  char line[WORD_SIZE] = "";
-  char *toks = NULL;
-  int start_len, step, next;
+  char *dialogue = NULL;
   Mission *mission = NULL;
-  Mission_Code code;
-
-  if (!filename || !game)
-  {
-    return ERROR;
-  }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
+  mission = game_get_mission_in_pos(game, (int)gameManagement_next_long(&fields, "|\r\n"));
+  if (!mission)
   {
     return ERROR;
   }
-  /**
-   * reads the file and loads each data individually.
-   */
-  start_len = (int)strlen("#mo:");
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
-  {
-    if (strncmp("#mo:", line, start_len) == 0)
-    {
-      mission = mission_create();
-      if (!mission)
-      {
-        fclose(file);
-        return ERROR;
-      }
-      toks = strtok(line + start_len, "|\r\n");
-      code = atol(toks);
-      mission_set_code(mission, code);
-      toks = strtok(NULL, "|\r\n");
-      step = atol(toks);
-      mission_set_current_step(mission, step);
-
-      toks = strtok(NULL, "|\r\n");
-      next = atol(toks);
-      mission_set_next_objective(mission, next);
-
-      while ((toks = strtok(NULL, "|\n\r")))
-      {
-        if (mission_add_objective(mission, toks))
-          ;
-      }
-      if (!game_add_mission(game, mission))
-      {
-        mission_destroy(mission);
-        fclose(file);
-        return ERROR;
-      }
-    }
-
-    if (strncmp("#mt:", line, start_len) == 0)
-    {
-
-      toks = strtok(line + start_len, "|\r\n");
-      code = atol(toks);
-
-      mission = game_get_mission_in_pos(game, code);
-      if (!mission)
-      {
-        fclose(file);
-        return ERROR;
-      }
 
-      toks = strtok(NULL, "|\r\n");
-      next = atol(toks);
-      mission_set_next_dialogue(mission, next);
+  mission_set_next_dialogue(mission, (int)gameManagement_next_long(&fields, "|\r\n"));
 
-      while ((toks = strtok(NULL, "|\n\r")))
-      {
-        mission_add_dialogue(mission, toks);
-      }
-    }
-  }
-
-  if (ferror(file))
+  while ((dialogue = gameManagement_next_string(&fields, "|\n\r")))
   {
-    status = ERROR;
+    mission_add_dialogue(mission, dialogue);
   }
 
-  fclose(file);
-  return status;
+  return OK;
 }
 
 Status gameManagement_save(Game *game, char *filename)
 {
-  FILE *save = NULL;
   if (!game || !filename)
     return ERROR;
-  save = fopen(filename, "w");
 
-  if (!save)
-    return ERROR;
+  return snapshot_save(game, filename);
+}
 
-  /*Ahora vamos a escribir todos los datos del juego en el fichero de texto*/
+Status gameManagement_save_background(Game *game, char *filename)
+{
+  Saver *saver = NULL;
+  char *data = NULL;
+  long size;
 
-  if (!gameManagement_save_objects(game, save))
-  {
-    printf("Error en el guardado de objetos.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_players(game, save))
-  {
-    printf("Error en el guardado de jugadores.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_turn(game, save))
-  {
-    printf("Error en el guardado del turno.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_spaces(game, save))
-  {
-    printf("Error en el guardado de espacios.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_characters(game, save))
-  {
-    printf("Error en el guardado de personajes.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_links(game, save))
-  {
-    printf("Error en el guardado de enlaces.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_interface(game, save))
-  {
-    printf("Error en el guardado de la interfaz.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_missions(game, save))
-  {
-    printf("Error en el guardado de misiones.\n");
-    fclose(save);
-    return ERROR;
-  }
-  if (!gameManagement_save_cinematics(game, save))
-  {
-    printf("Error en el guardado de cinemáticas.\n");
-    fclose(save);
+  if (!game || !filename)
     return ERROR;
-  }
-  if (!gameManagement_save_current_cinematic(game, save))
-  {
-    printf("Error en el guardado de turno de cinemáticas.\n");
-    fclose(save);
+
+  if (snapshot_build(game, &data, &size) == ERROR)
     return ERROR;
-  }
-  if (!gameManagement_save_current_mission(game, save))
-  {
-    printf("Error en el guardado de turno de mision.\n");
-    fclose(save);
+  /*A save still being written is not waited for here, the new one waits for it in its thread, as they could be to the same file*/
+  if (!(saver = saver_start(data, size, filename, game_get_saver(game))))
     return ERROR;
-  }
-  if (!gameManagement_save_lights(game, save))
-  {
-    printf("Error en el guardado del estado de las luces.\n");
-    fclose(save);
+  return game_set_saver(game, saver);
+}
+
+Bool gameManagement_save_pending(Game *game)
+{
+  if (!game || !game_get_saver(game))
+    return FALSE;
+  return saver_is_done(game_get_saver(game)) == TRUE ? FALSE : TRUE;
+}
+
+Status gameManagement_save_finish(Game *game)
+{
+  Status status;
+
+  if (!game)
     return ERROR;
-  }
+  if (!game_get_saver(game))
+    return OK;
 
-  fclose(save);
-  return OK;
+  status = saver_finish(game_get_saver(game));
+  game_set_saver(game, NULL);
+  return status;
 }
 
 Status gameManagement_load(Game **game, char *filename)
@@ -859,38 +854,35 @@ Status gameManagement_load(Game **game, char *filename)
     return ERROR;
   /*Guardamos el nombre del fichero de manera independiente al game*/
   strcpy(filename_cpy, filename);
-  /*creamos el nuevo juego segun los datos de la copia del guardado*/
-  if (game_create_from_file(&new_game, filename_cpy) == ERROR)
-  {
-    game_destroy(new_game);
-    return ERROR;
-  }
-
-  if (gameManagement_load_turn(new_game, filename_cpy) == ERROR)
-  {
-    game_destroy(new_game);
-    return ERROR;
-  }
-  if (gameManagement_load_interface(new_game, filename_cpy) == ERROR)
-  {
-    game_destroy(new_game);
-    return ERROR;
-  }
-  if (gameManagement_load_current_cinematic(new_game, filename) == ERROR)
+  /*The file could be the one a save in the background is still writing*/
+  gameManagement_save_finish(*game);
+  /*A snapshot only has the state of the game, it is restored into a copy so the game is kept if the snapshot is rejected*/
+  if (snapshot_is_snapshot(filename_cpy) == TRUE)
   {
-    game_destroy(new_game);
-    return ERROR;
+    if (game_create_copy(&new_game, *game) == ERROR)
+      return ERROR;
+    if (snapshot_load(new_game, filename_cpy) == ERROR)
+    {
+      game_destroy(new_game);
+      return ERROR;
+    }
+    game_destroy(*game);
+    *game = new_game;
+    return OK;
   }
-  if (gameManagement_load_current_mission(new_game, filename) == ERROR)
+  /*The saved game is usually of the same world, so only its state is restored, into a copy that shares the static content of the game*/
+  if (game_create_copy(&new_game, *game) == OK && gameManagement_restore(new_game, filename_cpy) == ERROR)
   {
     game_destroy(new_game);
-    return ERROR;
+    new_game = NULL;
   }
-  if (gameManagement_load_light(new_game, filename) == ERROR)
+  /*si el guardado es de otro mundo, creamos el nuevo juego segun los datos de la copia del guardado, el estado de la partida se lee en la misma pasada*/
+  if (!new_game && game_create_from_file(&new_game, filename_cpy) == ERROR)
   {
     game_destroy(new_game);
     return ERROR;
   }
+
   /*si todo ha funcionado, se destruye el anterior juego y se intercambian punteros*/
   if (game_destroy(*game) == ERROR)
     return ERROR;
@@ -902,550 +894,430 @@ Status gameManagement_load(Game **game, char *filename)
 
 /*Implementation of private functions*/
 
-Status gameManagement_save_objects(Game *game, FILE *saving_file)
+Status gameManagement_load_interface(Game *game, Field fields)
 {
-  int i;
-  Object *object = NULL;
-  if (!game || !saving_file)
+  char *token = NULL;
+  int pos, i = 0;
+  extern char *cmd_to_str[N_CMD][N_CMDT];
+  Command *lastCmd = NULL, *second_to_lastCmd = NULL, *third_to_lastCmd = NULL;
+  CommandCode cmdCode;
+  Status success;
+  Bool show;
+
+  if (!game)
     return ERROR;
 
-  for (i = 0; i < game_get_n_objects(game); i++)
+  pos = (int)gameManagement_next_long(&fields, "|\r\n");
+
+  lastCmd = game_interface_in_pos_get_lastCmd(game, pos);
+  if (!lastCmd)
   {
-    object = game_get_object_in_pos(game, i);
-    fprintf(saving_file, "#o:%ld|%s|%s|%ld|%s|%d|%d|%ld|%ld|\n", object_get_id(object), object_get_name(object), object_get_gdesc(object), game_get_object_location(game, object_get_id(object)), object_get_description(object), object_get_movable(object) == TRUE ? 1 : 0, object_get_health(object), object_get_dependency(object), object_get_open(object));
+    return ERROR;
   }
 
-  return OK;
-}
-
-Status gameManagement_save_players(Game *game, FILE *saving_file)
-{
-  int i, j;
-  Player *player = NULL;
-
-  if (!game || !saving_file)
+  second_to_lastCmd = game_interface_in_pos_get_second_to_last_Cmd(game, pos);
+  if (!second_to_lastCmd)
+  {
     return ERROR;
+  }
 
-  for (i = 0; i < game_get_n_players(game); i++)
+  third_to_lastCmd = game_interface_in_pos_get_third_to_last_Cmd(game, pos);
+  if (!third_to_lastCmd)
   {
-    player = game_get_player_in_pos(game, i);
-    fprintf(saving_file, "#p:%ld|%s|%s|%ld|%d|%d|%ld|", player_get_id(player), player_get_name(player), player_get_gdesc(player), player_get_location(player), player_get_health(player), inventory_get_max_objs(player_get_inventory(player)), player_get_team(player));
+    return ERROR;
+  }
 
-    for (j = 0; j < player_get_num_objects_in_backpack(player); j++)
+  /*The names are searched from "No command", so the empty entries of the history are not loaded as unknown commands*/
+  token = gameManagement_next_string(&fields, "/|\r\n");
+  i = 0;
+  cmdCode = UNKNOWN;
+  while (cmdCode == UNKNOWN && i < N_CMD)
+  {
+    if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL]))
+    {
+      cmdCode = i + NO_CMD;
+    }
+    else
     {
-      fprintf(saving_file, "%ld|", player_get_backpack_object_id_at(player, j));
+      i++;
     }
-    fprintf(saving_file, "\n");
   }
 
-  return OK;
-}
+  command_set_code(lastCmd, cmdCode);
 
-Status gameManagement_save_turn(Game *game, FILE *saving_file)
-{
-  if (!game || !saving_file)
-    return ERROR;
-
-  fprintf(saving_file, "#t:%d\n", game_get_turn(game));
-
-  return OK;
-}
-Status gameManagement_save_spaces(Game *game, FILE *saving_file)
-{
-  int i, j;
-  Space *space = NULL;
-  char **gdesc = NULL;
-
-  if (!game || !saving_file)
-    return ERROR;
-  for (i = 0; i < game_get_n_spaces(game); i++)
+  if (cmdCode == TAKE || cmdCode == INSPECT || cmdCode == DROP || cmdCode == MOVE || cmdCode == RECRUIT || cmdCode == ABANDON || cmdCode == CHAT || cmdCode == ATTACK || cmdCode == SAVE || cmdCode == LOAD)
   {
+    token = gameManagement_next_string(&fields, "/|\r\n");
 
-    space = game_get_space_in_pos(game, i);
-    gdesc = space_get_gdesc(space);
-    fprintf(saving_file, "#s:%ld|%s|%d|\n", space_get_id(space), space_get_name(space), space_get_discovered(space) == TRUE ? 1 : 0);
-    for (j = 0; j < N_TOTAL_ROWS_IN_SQUARE; j++)
-    {
-      fprintf(saving_file, "%s\n", gdesc[j]);
-    }
+    if (command_set_argument(lastCmd, token) == ERROR)
+      return ERROR;
+  }
+  else
+  {
+    command_set_argument(lastCmd, NO_ARG);
   }
+  token = gameManagement_next_string(&fields, "/|\r\n");
 
-  return OK;
-}
-Status gameManagement_save_characters(Game *game, FILE *saving_file)
-{
-  int i, j;
-  Character *character = NULL;
-  if (!game || !saving_file)
-    return ERROR;
+  success = !strcmp(token, "ERROR") ? ERROR : OK;
+  command_set_lastcmd_success(lastCmd, success);
 
-  for (i = 0; i < game_get_n_characters(game); i++)
+  cmdCode = UNKNOWN;
+  token = gameManagement_next_string(&fields, "/|\r\n");
+
+  i = 0;
+  while (cmdCode == UNKNOWN && i < N_CMD)
   {
-    character = game_get_character_in_pos(game, i);
-    fprintf(saving_file, "#c:%ld|%s|%s|%s|%ld|%d|%d|%ld|", character_get_id(character), character_get_name(character), character_get_gdesc(character), character_get_dead_gdesc(character), character_get_location(character), character_get_health(character), character_get_friendly(character), character_get_following(character));
-    for (j = 0; j < character_get_n_messages(character); j++)
+    if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL]))
+    {
+      cmdCode = i + NO_CMD;
+    }
+    else
     {
-      fprintf(saving_file, "%s|", character_get_message_in_pos(character, j));
+      i++;
     }
-    fprintf(saving_file, "\n");
   }
 
-  return OK;
-}
-Status gameManagement_save_links(Game *game, FILE *saving_file)
-{
-  int i;
-  Link *link = NULL;
+  command_set_code(second_to_lastCmd, cmdCode);
 
-  if (!game || !saving_file)
-    return ERROR;
+  if (cmdCode == TAKE || cmdCode == INSPECT || cmdCode == DROP || cmdCode == MOVE || cmdCode == RECRUIT || cmdCode == ABANDON || cmdCode == CHAT || cmdCode == ATTACK || cmdCode == SAVE || cmdCode == LOAD)
+  {
+    token = gameManagement_next_string(&fields, "/|\r\n");
 
-  for (i = 0; i < game_get_n_links(game); i++)
+    if (command_set_argument(second_to_lastCmd, token) == ERROR)
+      return ERROR;
+  }
+  else
   {
-    link = game_get_link_in_pos(game, i);
-    fprintf(saving_file, "#l:%ld|%s|%ld|%ld|%d|%d|\n", link_get_id(link), link_get_name(link), link_get_origin_id(link), link_get_destination_id(link), link_get_direction(link), link_get_is_open(link));
+    command_set_argument(second_to_lastCmd, NO_ARG);
   }
+  token = gameManagement_next_string(&fields, "/|\r\n");
 
-  return OK;
-}
+  success = !strcmp(token, "ERROR") ? ERROR : OK;
+  command_set_lastcmd_success(second_to_lastCmd, success);
 
-Status gameManagement_save_interface(Game *game, FILE *saving_file)
-{
-  int i;
-  Command *lastCmd = NULL, *second_to_last = NULL, *third_to_last = NULL;
-  extern char *cmd_to_str[N_CMD][N_CMDT];
-  char *lastCmdName = NULL, *second_to_lastName = NULL, *third_to_lastName = NULL;
-  CommandCode lastCmdCode, second_to_lastCode, third_to_lastCode;
-
-  if (!game || !saving_file)
-    return ERROR;
+  token = gameManagement_next_string(&fields, "/|\r\n");
 
-  for (i = 0; i < game_get_n_players(game); i++)
+  i = 0;
+  cmdCode = UNKNOWN;
+  while (cmdCode == UNKNOWN && i < N_CMD)
   {
-
-    lastCmd = game_interface_in_pos_get_lastCmd(game, i);
-    second_to_last = game_interface_in_pos_get_second_to_last_Cmd(game, i);
-    third_to_last = game_interface_in_pos_get_third_to_last_Cmd(game, i);
-
-    lastCmdName = cmd_to_str[command_get_code(lastCmd) - NO_CMD][CMDL];
-    second_to_lastName = cmd_to_str[command_get_code(second_to_last) - NO_CMD][CMDL];
-    third_to_lastName = cmd_to_str[command_get_code(third_to_last) - NO_CMD][CMDL];
-
-    lastCmdCode = command_get_code(lastCmd);
-    second_to_lastCode = command_get_code(second_to_last);
-    third_to_lastCode = command_get_code(third_to_last);
-
-    fprintf(saving_file, "#i:%d", i);
-    if (lastCmdCode == TAKE || lastCmdCode == INSPECT || lastCmdCode == DROP || lastCmdCode == MOVE || lastCmdCode == ATTACK || lastCmdCode == CHAT || lastCmdCode == ABANDON || lastCmdCode == RECRUIT || lastCmdCode == SAVE || lastCmdCode == LOAD)
+    if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL]))
     {
-      fprintf(saving_file, "|%s/%s/%s|", lastCmdName, command_get_argument(lastCmd), command_get_lastcmd_success(lastCmd) == OK ? "OK" : "ERROR");
+      cmdCode = i + NO_CMD;
     }
     else
     {
-      fprintf(saving_file, "|%s/%s|", lastCmdName, command_get_lastcmd_success(lastCmd) == OK ? "OK" : "ERROR");
+      i++;
     }
+  }
 
-    if (second_to_lastCode == TAKE || second_to_lastCode == INSPECT || second_to_lastCode == DROP || second_to_lastCode == MOVE || second_to_lastCode == ATTACK || second_to_lastCode == CHAT || second_to_lastCode == ABANDON || second_to_lastCode == RECRUIT || second_to_lastCode == SAVE || second_to_lastCode == LOAD)
-    {
-      fprintf(saving_file, "%s/%s/%s|", second_to_lastName, command_get_argument(second_to_last), command_get_lastcmd_success(second_to_last) == OK ? "OK" : "ERROR");
-    }
-    else
-    {
-      fprintf(saving_file, "%s/%s|", second_to_lastName, command_get_lastcmd_success(second_to_last) == OK ? "OK" : "ERROR");
-    }
+  command_set_code(third_to_lastCmd, cmdCode);
 
-    if (third_to_lastCode == TAKE || third_to_lastCode == INSPECT || third_to_lastCode == DROP || third_to_lastCode == MOVE || third_to_lastCode == ATTACK || third_to_lastCode == CHAT || third_to_lastCode == ABANDON || third_to_lastCode == RECRUIT || third_to_lastCode == SAVE || third_to_lastCode == LOAD)
-    {
-      fprintf(saving_file, "%s/%s/%s|", third_to_lastName, command_get_argument(third_to_last), command_get_lastcmd_success(third_to_last) == OK ? "OK" : "ERROR");
-    }
-    else
-    {
-      fprintf(saving_file, "%s/%s|", third_to_lastName, command_get_lastcmd_success(third_to_last) == OK ? "OK" : "ERROR");
-    }
+  if (cmdCode == TAKE || cmdCode == INSPECT || cmdCode == DROP || cmdCode == MOVE || cmdCode == RECRUIT || cmdCode == ABANDON || cmdCode == CHAT || cmdCode == ATTACK || cmdCode == SAVE || cmdCode == LOAD)
+  {
+    token = gameManagement_next_string(&fields, "/|\r\n");
 
-    fprintf(saving_file, "%s|%s|%s|%d|\n", game_interface_in_pos_get_message(game, i), game_interface_in_pos_get_description(game, i), game_interface_in_pos_get_objective(game, i), game_get_show_message(game, i) == TRUE ? 1 : 0);
+    if (command_set_argument(third_to_lastCmd, token) == ERROR)
+      return ERROR;
+  }
+  else
+  {
+    command_set_argument(third_to_lastCmd, NO_ARG);
   }
+  token = gameManagement_next_string(&fields, "/|\r\n");
 
-  return OK;
-}
+  success = !strcmp(token, "ERROR") ? ERROR : OK;
 
-Status gameManagement_save_missions(Game *game, FILE *saving_file)
-{
-  int i, j;
-  Mission *mission = NULL;
-  if (!game || !saving_file)
-    return ERROR;
+  command_set_lastcmd_success(third_to_lastCmd, success);
 
-  for (i = 0; i < game_get_n_missions(game); i++)
-  {
-    mission = game_get_mission_in_pos(game, i);
-    if (!mission)
-      return ERROR;
-    fprintf(saving_file, "#mo:%d|%d|%d|", mission_get_code(mission), mission_get_current_step(mission), mission_get_next_objective_index(mission));
+  token = gameManagement_next_string(&fields, "/|\r\n");
+  game_interface_in_pos_set_message(game, pos, token);
 
-    for (j = 0; j < mission_get_n_objectives(mission); j++)
-    {
-      fprintf(saving_file, "%s|", mission_get_objective_in_pos(mission, j));
-    }
-    fprintf(saving_file, "\n");
-    fprintf(saving_file, "#mt:%d|%d|", mission_get_code(mission), mission_get_next_dialogue_index(mission));
-    for (j = 0; j < mission_get_n_dialogues(mission); j++)
-    {
-      fprintf(saving_file, "%s|", mission_get_dialogue_in_pos(mission, j));
-    }
-    fprintf(saving_file, "\n");
-  }
+  token = gameManagement_next_string(&fields, "/|\r\n");
+
+  game_interface_in_pos_set_description(game, pos, token);
+
+  token = gameManagement_next_string(&fields, "/|\r\n");
+
+  game_interface_in_pos_set_objective(game, pos, token);
+
+  show = gameManagement_next_long(&fields, "/|\r\n") == 1 ? TRUE : FALSE;
+  game_set_show_message(game, show, (Protagonists)pos);
 
   return OK;
 }
 
-Status gameManagement_save_cinematics(Game *game, FILE *saving_file)
+Status gameManagement_restore(Game *game, char *filename)
 {
-  int i, j;
-  Cinematics_text *cinematic = NULL;
+  Reader *reader = NULL;
+  Field line;
+  int i, n_spaces = 0, n_objects = 0, n_players = 0, n_characters = 0, n_links = 0, n_missions = 0;
+  int turn = -1, current_cinematic = -1, current_mission = -1, lights = -1;
+  Status status = OK;
 
-  if (!game || !saving_file)
+  if (!game || !filename || !(reader = reader_open(filename)))
+  {
     return ERROR;
+  }
 
-  for (i = 0; i < N_CINEMATICS; i++)
+  game_clear_placements(game);
+  while (status == OK && reader_next_line(reader, &line))
   {
-    cinematic = game_get_cinematic_text_in_pos(game, i);
-    for (j = 0; j < cinematics_get_n_lines(cinematic); j++)
+    switch (gameManagement_get_tag(&line))
     {
-      fprintf(saving_file, "#cin:%d|%s|\n", i, cinematics_get_line(cinematic, j));
+    case SPACE_TAG:
+      status = gameManagement_restore_space(game, line, reader);
+      n_spaces++;
+      break;
+    case OBJECT_TAG:
+      status = gameManagement_restore_object(game, line);
+      n_objects++;
+      break;
+    case PLAYER_TAG:
+      status = gameManagement_restore_player(game, line);
+      n_players++;
+      break;
+    case CHARACTER_TAG:
+      status = gameManagement_restore_character(game, line);
+      n_characters++;
+      break;
+    case LINK_TAG:
+      status = gameManagement_restore_link(game, line);
+      n_links++;
+      break;
+    case MISSION_TAG:
+      status = gameManagement_restore_mission(game, line, n_missions);
+      n_missions++;
+      break;
+    case MISSION_DIALOGUE_TAG:
+      status = gameManagement_restore_mission_dialogues(game, line);
+      break;
+    case INTERFACE_TAG:
+      status = gameManagement_load_interface(game, line);
+      break;
+    case TURN_TAG:
+      turn = (int)gameManagement_next_long(&line, "\n\r");
+      break;
+    case CURRENT_CINEMATIC_TAG:
+      current_cinematic = (int)gameManagement_next_long(&line, "|\r\n");
+      break;
+    case CURRENT_MISSION_TAG:
+      current_mission = (int)gameManagement_next_long(&line, "\n\r");
+      break;
+    case LIGHT_TAG:
+      lights = (int)gameManagement_next_long(&line, "\n\r");
+      break;
+    default:
+      /*The cinematics and the counts are part of the world, which the game already has*/
+      break;
     }
   }
+  reader_close(reader);
 
-  return OK;
-}
-
-Status gameManagement_save_current_cinematic(Game *game, FILE *saving_file)
-{
-  if (!game || !saving_file)
+  /*Every entity of the game must have had its record, otherwise the file is of another world*/
+  if (status == ERROR || n_spaces != game_get_n_spaces(game) || n_objects != game_get_n_objects(game) || n_players != game_get_n_players(game) || n_characters != game_get_n_characters(game) || n_links != game_get_n_links(game) || n_missions != game_get_n_missions(game))
+  {
     return ERROR;
-  fprintf(saving_file, "#ccur:%d\n", game_get_current_cinematic(game));
-  return OK;
-}
+  }
 
-Status gameManagement_save_current_mission(Game *game, FILE *saving_file)
-{
-  if (!game || !saving_file)
+  for (i = 0; i < game_get_n_players(game); i++)
+  {
+    space_set_discovered(game_get_space(game, player_get_location(game_get_player_in_pos(game, i))), TRUE);
+  }
+  game_set_finished(game, FALSE);
+  if (turn != -1 && game_set_turn(game, turn) == ERROR)
+  {
+    return ERROR;
+  }
+  if (current_cinematic != -1)
+  {
+    game_set_current_cinematic(game, current_cinematic);
+  }
+  if (current_mission != -1 && game_set_current_mission(game, current_mission) == ERROR)
+  {
+    return ERROR;
+  }
+  if (lights != -1 && game_set_lights_on(game, lights == 1 ? TRUE : FALSE) == ERROR)
+  {
     return ERROR;
-  fprintf(saving_file, "#mcur:%d\n", game_get_current_mission_code(game));
+  }
+
   return OK;
 }
 
-Status gameManagement_load_turn(Game *game, char *filename)
+Status gameManagement_restore_space(Game *game, Field fields, Reader *reader)
 {
-  FILE *save = NULL;
-  char line[WORD_SIZE] = "";
-  char *token = NULL;
-  int turn;
-
-  if (!game || !filename)
-    return ERROR;
-
-  save = fopen(filename, "r");
+  Field line;
+  Space *space = NULL;
+  char *name = NULL;
+  int i, discovered;
+  Id id, art_id;
 
-  if (!save)
-    return ERROR;
+  id = gameManagement_next_long(&fields, "|");
+  name = gameManagement_next_string(&fields, "|");
+  discovered = (int)gameManagement_next_long(&fields, "|");
+  art_id = gameManagement_next_long(&fields, "|");
 
-  while (fgets(line, WORD_SIZE, save))
+  /*The lines of the graphic description are skipped, the space keeps the one it has*/
+  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE && art_id == 0; i++)
   {
-    if (strncmp("#t:", line, 3))
-    {
-      token = strtok(line + 3, "\n\r");
-      turn = atoi(token);
-    }
+    reader_next_line(reader, &line);
   }
 
-  fclose(save);
-  if (game_set_turn(game, turn) == ERROR)
+  if (!(space = game_get_space(game, id)) || !name || strcmp(space_get_name(space), name) != 0)
   {
     return ERROR;
   }
-  return OK;
-}
 
-Status gameManagement_save_lights(Game *game, FILE *saving_file)
-{
-  if (!game || !saving_file)
-    return ERROR;
-  fprintf(saving_file, "#light:%d\n", game_get_lights_on(game) == TRUE ? 1 : 0);
-  return OK;
+  return space_set_discovered(space, discovered == 1 ? TRUE : FALSE);
 }
 
-Status gameManagement_load_interface(Game *game, char *filename)
+Status gameManagement_restore_object(Game *game, Field fields)
 {
-  FILE *save = NULL;
-  char line[WORD_SIZE] = "";
-  char *token = NULL;
-  int pos, i = 2;
-  extern char *cmd_to_str[N_CMD][N_CMDT];
-  Command *lastCmd = NULL, *second_to_lastCmd = NULL, *third_to_lastCmd = NULL;
-  CommandCode cmdCode;
-  Status success;
-  Bool show;
-
-  if (!game || !filename)
-    return ERROR;
-
-  save = fopen(filename, "r");
-  if (!save)
+  Object *object = NULL;
+  char *name = NULL;
+  Id id, spaceId, dependency, open;
+  int movable, health;
+
+  id = gameManagement_next_long(&fields, "|");
+  name = gameManagement_next_string(&fields, "|");
+  gameManagement_next_string(&fields, "|\r\n");
+  spaceId = gameManagement_next_long(&fields, "|");
+  gameManagement_next_string(&fields, "|\n\r");
+  movable = (int)gameManagement_next_long(&fields, "|\n\r");
+  health = (int)gameManagement_next_long(&fields, "|\n\r");
+  dependency = gameManagement_next_long(&fields, "|\n\r");
+  open = gameManagement_next_long(&fields, "|\n\r");
+
+  if (!(object = game_get_object(game, id)) || !name || strcmp(object_get_name(object), name) != 0)
+  {
     return ERROR;
+  }
 
-  while (fgets(line, WORD_SIZE, save))
+  object_set_movable(object, movable == 1 ? TRUE : FALSE);
+  object_set_health(object, health);
+  object_set_dependency(object, dependency);
+  object_set_open(object, open);
+  /*The objects in a backpack have no space, they are placed with the record of the player*/
+  if (spaceId != NO_ID)
   {
-    if (!strncmp("#i:", line, 3))
-    {
-      token = strtok(line + 3, "|\r\n");
-      pos = atoi(token);
-
-      lastCmd = game_interface_in_pos_get_lastCmd(game, pos);
-      if (!lastCmd)
-      {
-        fclose(save);
-        return ERROR;
-      }
-
-      second_to_lastCmd = game_interface_in_pos_get_second_to_last_Cmd(game, pos);
-      if (!second_to_lastCmd)
-      {
-        fclose(save);
-        return ERROR;
-      }
-
-      third_to_lastCmd = game_interface_in_pos_get_third_to_last_Cmd(game, pos);
-      if (!third_to_lastCmd)
-      {
-        fclose(save);
-        return ERROR;
-      }
-
-      token = strtok(NULL, "/|\r\n");
-      i = 2;
-      cmdCode = UNKNOWN;
-      while (cmdCode == UNKNOWN && i < N_CMD)
-      {
-        if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL]))
-        {
-          cmdCode = i + NO_CMD;
-        }
-        else
-        {
-          i++;
-        }
-      }
-
-      command_set_code(lastCmd, cmdCode);
-
-      if (cmdCode == TAKE || cmdCode == INSPECT || cmdCode == DROP || cmdCode == MOVE || cmdCode == RECRUIT || cmdCode == ABANDON || cmdCode == CHAT || cmdCode == ATTACK || cmdCode == SAVE || cmdCode == LOAD)
-      {
-        token = strtok(NULL, "/|\r\n");
-
-        if (command_set_argument(lastCmd, token) == ERROR)
-          return ERROR;
-      }
-      command_set_argument(lastCmd, NO_ARG);
-      token = strtok(NULL, "/|\r\n");
-
-      success = !strcmp(token, "ERROR") ? ERROR : OK;
-      command_set_lastcmd_success(lastCmd, success);
-
-      cmdCode = UNKNOWN;
-      token = strtok(NULL, "/|\r\n");
-
-      i = 2;
-      while (cmdCode == UNKNOWN && i < N_CMD)
-      {
-        if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL]))
-        {
-          cmdCode = i + NO_CMD;
-        }
-        else
-        {
-          i++;
-        }
-      }
-
-      command_set_code(second_to_lastCmd, cmdCode);
-
-      if (cmdCode == TAKE || cmdCode == INSPECT || cmdCode == DROP || cmdCode == MOVE || cmdCode == RECRUIT || cmdCode == ABANDON || cmdCode == CHAT || cmdCode == ATTACK || cmdCode == SAVE || cmdCode == LOAD)
-      {
-        token = strtok(NULL, "/|\r\n");
-
-        if (command_set_argument(second_to_lastCmd, token) == ERROR)
-          return ERROR;
-      }
-      command_set_argument(second_to_lastCmd, NO_ARG);
-      token = strtok(NULL, "/|\r\n");
-
-      success = !strcmp(token, "ERROR") ? ERROR : OK;
-      command_set_lastcmd_success(second_to_lastCmd, success);
-
-      token = strtok(NULL, "/|\r\n");
-
-      i = 2;
-      cmdCode = UNKNOWN;
-      while (cmdCode == UNKNOWN && i < N_CMD)
-      {
-        if (!strcasecmp(token, cmd_to_str[i][CMDS]) || !strcasecmp(token, cmd_to_str[i][CMDL]))
-        {
-          cmdCode = i + NO_CMD;
-        }
-        else
-        {
-          i++;
-        }
-      }
-
-      command_set_code(third_to_lastCmd, cmdCode);
-
-      if (cmdCode == TAKE || cmdCode == INSPECT || cmdCode == DROP || cmdCode == MOVE || cmdCode == RECRUIT || cmdCode == ABANDON || cmdCode == CHAT || cmdCode == ATTACK || cmdCode == SAVE || cmdCode == LOAD)
-      {
-        token = strtok(NULL, "/|\r\n");
-
-        if (command_set_argument(third_to_lastCmd, token) == ERROR)
-          return ERROR;
-      }
-      command_set_argument(third_to_lastCmd, NO_ARG);
-      token = strtok(NULL, "/|\r\n");
-
-      success = !strcmp(token, "ERROR") ? ERROR : OK;
-
-      command_set_lastcmd_success(third_to_lastCmd, success);
-
-      token = strtok(NULL, "/|\r\n");
-      game_interface_in_pos_set_message(game, pos, token);
-
-      token = strtok(NULL, "/|\r\n");
-
-      game_interface_in_pos_set_description(game, pos, token);
-
-      token = strtok(NULL, "/|\r\n");
-
-      game_interface_in_pos_set_objective(game, pos, token);
-
-      token = strtok(NULL, "/|\r\n");
-      show = atol(token) == 1 ? TRUE : FALSE;
-      game_set_show_message(game, show, (Protagonists)pos);
-    }
+    return space_add_objectId(game_get_space(game, spaceId), id);
   }
 
-  fclose(save);
   return OK;
 }
 
-Status gameManagement_load_current_cinematic(Game *game, char *filename)
+Status gameManagement_restore_player(Game *game, Field fields)
 {
-  FILE *file = NULL;
-  Status status = OK;
-  char line[WORD_SIZE] = "";
-  char *toks = NULL;
-  int i, start_len;
+  Player *player = NULL;
+  Field field;
+  char *name = NULL;
+  Id id, spaceId;
+  int hp, inventory_size;
 
-  if (!filename || !game)
+  id = gameManagement_next_long(&fields, "|\r\n");
+  name = gameManagement_next_string(&fields, "|\r\n");
+  gameManagement_next_string(&fields, "|\r\n");
+  spaceId = gameManagement_next_long(&fields, "|\r\n");
+  hp = (int)gameManagement_next_long(&fields, "|\r\n");
+  inventory_size = (int)gameManagement_next_long(&fields, "|\n\r");
+
+  if (!(player = game_get_player(game, id)) || !name || strcmp(player_get_name(player), name) != 0)
   {
     return ERROR;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
+  player_set_location(player, spaceId);
+  player_set_health(player, hp);
+  player_set_max_objs(player, inventory_size);
+  /*A player without a team is in its own one, as when it is created*/
+  if (field_next(&fields, "|\n\r", &field) && field_to_long(field) != NO_ID)
+    player_set_team(player, field_to_long(field));
+  else
+    player_set_team(player, id);
+  /*The rest of the fields are the objects in the backpack*/
+  while (field_next(&fields, "|\n\r", &field))
   {
-    return ERROR;
+    player_add_object_to_backpack(player, field_to_long(field));
   }
-  /**
-   * reads the file and loads each data individually.
-   */
-  start_len = (int)strlen("#ccur:");
-  while (fgets(line, WORD_SIZE, file)) /*Reads all the lines in the text file and saves the provided information*/
-  {
-    if (strncmp("#ccur:", line, start_len) == 0)
-    {
-      toks = strtok(line + start_len, "|\r\n");
-      i = atol(toks);
-      game_set_current_cinematic(game, i);
 
-#ifdef DEBUG
-      printf("Leido: #ccur:%ld\n", i);
-#endif
-    }
-  }
+  return OK;
+}
 
-  if (ferror(file))
+Status gameManagement_restore_character(Game *game, Field fields)
+{
+  Character *character = NULL;
+  char *name = NULL;
+  Id id, spaceId, following;
+  int hp;
+  Bool friendliness;
+
+  id = gameManagement_next_long(&fields, "|\r\n");
+  name = gameManagement_next_string(&fields, "|\r\n");
+  gameManagement_next_string(&fields, "|\r\n");
+  gameManagement_next_string(&fields, "|\r\n");
+  spaceId = gameManagement_next_long(&fields, "|\r\n");
+  hp = (int)gameManagement_next_long(&fields, "|\r\n");
+  friendliness = (Bool)gameManagement_next_long(&fields, "|\r\n");
+  following = gameManagement_next_long(&fields, "|\r");
+
+  if (!(character = game_get_character(game, id)) || !name || strcmp(character_get_name(character), name) != 0)
   {
-    status = ERROR;
+    return ERROR;
   }
 
-  fclose(file);
+  character_set_location(character, spaceId);
+  character_set_health(character, hp);
+  character_set_friendly(character, friendliness);
+  character_set_following(character, following);
+  character_set_message_turn(character, 0);
+  space_add_character(game_get_space(game, spaceId), id);
 
-  return status;
+  return OK;
 }
 
-Status gameManagement_load_current_mission(Game *game, char *filename)
+Status gameManagement_restore_link(Game *game, Field fields)
 {
+  Link *link = NULL;
+  char *name = NULL;
+  Id id;
 
-  FILE *save = NULL;
-  char line[WORD_SIZE] = "";
-  char *token = NULL;
-  int i, start_len;
+  id = gameManagement_next_long(&fields, "|\r\n");
+  name = gameManagement_next_string(&fields, "|\r\n");
+  gameManagement_next_long(&fields, "|\r\n");
+  gameManagement_next_long(&fields, "|\r\n");
+  gameManagement_next_long(&fields, "|\r\n");
 
-  if (!game || !filename)
+  if (!(link = game_get_link(game, id)) || !name || strcmp(link_get_name(link), name) != 0)
+  {
     return ERROR;
+  }
 
-  save = fopen(filename, "r");
+  return link_set_is_open(link, (Bool)gameManagement_next_long(&fields, "|\r\n"));
+}
 
-  if (!save)
-    return ERROR;
-  start_len = strlen("#mcur:");
-  while (fgets(line, WORD_SIZE, save))
-  {
-    if (strncmp("#mcur:", line, start_len) == 0)
-    {
-      token = strtok(line + start_len, "\n\r");
-      i = atoi(token);
-    }
-  }
+Status gameManagement_restore_mission(Game *game, Field fields, int pos)
+{
+  Mission *mission = NULL;
 
-  fclose(save);
-  if (game_set_current_mission(game, i) == ERROR)
+  if (!(mission = game_get_mission_in_pos(game, pos)) || mission_get_code(mission) != (Mission_Code)gameManagement_next_long(&fields, "|\r\n"))
   {
     return ERROR;
   }
+  mission_set_current_step(mission, (int)gameManagement_next_long(&fields, "|\r\n"));
+  mission_set_next_objective(mission, (int)gameManagement_next_long(&fields, "|\r\n"));
+
   return OK;
 }
 
-Status gameManagement_load_light(Game *game, char *filename)
+Status gameManagement_restore_mission_dialogues(Game *game, Field fields)
 {
-  FILE *save = NULL;
-  char line[WORD_SIZE] = "";
-  char *token = NULL;
-  int i, start_len;
-  Bool lights_on;
-
-  if (!game || !filename)
-    return ERROR;
-
-  save = fopen(filename, "r");
+  Mission *mission = NULL;
 
-  if (!save)
-    return ERROR;
-  start_len = strlen("#light:");
-  while (fgets(line, WORD_SIZE, save))
-  {
-    if (strncmp("#light:", line, start_len) == 0)
-    {
-      token = strtok(line + start_len, "\n\r");
-      i = atoi(token);
-    }
-  }
-  lights_on = i == 1 ? TRUE : FALSE;
-  fclose(save);
-  if (game_set_lights_on(game, lights_on) == ERROR)
+  if (!(mission = game_get_mission_in_pos(game, (int)gameManagement_next_long(&fields, "|\r\n"))))
   {
     return ERROR;
   }
-  return OK;
-}
 
-/*END OF PRIVATE FUNCTIONS*/
\ No newline at end of file
+  return mission_set_next_dialogue(mission, (int)gameManagement_next_long(&fields, "|\r\n"));
+}
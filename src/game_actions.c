@@ -131,6 +131,8 @@ void game_actions_open(Game *game, char *arg1, char *arg2);
 
 /**
  * @brief saves the current game in the file with the name given in the arg
+ * The file is written in the background, the command succeeds once the state has been taken
+ * and the game loop tells the player if the file could not be written
  * @author Alvaro Inigo
  * @date 18/04/25
  * @param game a pointer to the game
@@ -335,8 +337,6 @@ void game_actions_move(Game *game, char *arg)
 void game_actions_take(Game *game, char *arg)
 {
   Id objectId = NO_ID;
-  int i;
-  Bool found = FALSE;
   Object *object = NULL;
 
   /*If the arguments (pointers) are NULL or the bacpack of the current player is full, nothing happens*/
@@ -349,24 +349,14 @@ void game_actions_take(Game *game, char *arg)
   game_set_show_message(game, FALSE, (Protagonists)game_get_turn(game));
 
   /*Find the object with the specified name "arg" in the game */
-  for (i = 0; i < game_get_n_objects(game) && found == FALSE; i++)
-  {
-    if (strcasecmp(arg, object_get_name(game_get_object_in_pos(game, i))) == 0)
-    {
-      found = TRUE;
-      i--;
-    }
-  }
-  if (found == FALSE)
+  if (!(object = game_get_object_from_name(game, arg)))
   {
     command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(game, LAST), ERROR);
     return;
   }
 
-  /*Now, that we have found the object with the name, we get its Id
-  and its pointer*/
-  objectId = game_get_object_id_at(game, i);
-  object = game_get_object_in_pos(game, i);
+  /*Now, that we have found the object with the name, we get its Id*/
+  objectId = object_get_id(object);
 
   /* Check if the object is movable */
   if (object_get_movable(object) == FALSE)
@@ -530,7 +520,7 @@ void game_actions_attack(Game *game, char *arg)
   Set *followers = NULL;
   Player *current_player = NULL;
   char message[MAX_MESSAGE];
-  num = rand() % MAX_RANDOM;
+  num = rng_range(game_get_rng(game), MAX_RANDOM);
 
   current_player = game_get_current_player(game);
 
@@ -664,7 +654,7 @@ void game_actions_attack(Game *game, char *arg)
   if (num <= ATTACK_CHANCE)
   {
     /*We generate a random number to determine who will receive damage from the enemy*/
-    attacked_ally = rand() % (set_get_num_elements(followers));
+    attacked_ally = rng_range(game_get_rng(game), set_get_num_elements(followers));
     /*If the number is 0, it is the player who receives damage*/
     if (attacked_ally == 0)
     {
@@ -710,9 +700,7 @@ void game_actions_inspect(Game *game, char *arg)
 {
   Id objectId = NO_ID;
   Space *current_space = NULL;
-  int i;
   Object *object = NULL;
-  Bool found = FALSE;
 
   if (!game || !arg)
   {
@@ -723,17 +711,7 @@ void game_actions_inspect(Game *game, char *arg)
   game_set_show_message(game, FALSE, (Protagonists)game_get_turn(game));
 
   /*We find the object with tha name arg*/
-  for (i = 0; i < game_get_n_objects(game); i++)
-  {
-    object = game_get_object_in_pos(game, i);
-    if (strcasecmp(object_get_name(object), arg) == 0)
-    {
-      found = TRUE;
-      break;
-    }
-  }
-
-  if (found == FALSE)
+  if (!(object = game_get_object_from_name(game, arg)))
   {
     command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(game, LAST), ERROR);
     return;
@@ -844,7 +822,6 @@ void game_actions_open(Game *game, char *arg1, char *arg2)
   for (i = 0; i < game_get_n_links(game); i++)
   {
     l = game_get_link(game, game_get_link_id_at(game, i));
-    printf("%s\n", link_get_name(l));
     /*check if link name matches first argument in the command*/
     if (strcasecmp(link_get_name(l), arg1) == 0)
     {
@@ -896,7 +873,7 @@ void game_actions_save(Game *game, char *arg)
     return;
   }
 
-  if (gameManagement_save(game, arg) == ERROR)
+  if (gameManagement_save_background(game, arg) == ERROR)
   {
     command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(game, LAST), ERROR);
     return;
@@ -907,35 +884,23 @@ void game_actions_save(Game *game, char *arg)
 
 void game_actions_load(Game **game, char *arg)
 {
-  Command *command = NULL, *command_cpy = NULL;
+  Command *command = NULL;
+  Status status;
   if (!game || !(*game) || !arg)
   {
     command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(*game, LAST), ERROR);
     return;
   }
-  /*We save the command load to paint it after loading*/
-  command = game_interface_data_get_cmd_in_pos(*game, LAST);
-  command_cpy = command_create();
-  if (!command || !command_cpy)
+  /*The command load is the one the game loop is running, so it is taken out of the history before the old game is destroyed and given back to the loaded one*/
+  if (!(command = game_interface_data_take_last_command(*game)))
   {
     command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(*game, LAST), ERROR);
     return;
   }
-  command_set_code(command_cpy, command_get_code(command));
-  command_set_argument(command_cpy, command_get_argument(command));
-  command_set_argument2(command_cpy, command_get_argument2(command));
-  /*END of copying the command*/
 
-  if (gameManagement_load(game, arg) == ERROR)
-  {
-    command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(*game, LAST), ERROR);
-    return;
-  }
-  else
-  {
-    game_interface_data_set_last_command(*game, command_cpy);
-    command_set_lastcmd_success(game_interface_data_get_cmd_in_pos(*game, LAST), OK);
-  }
+  status = gameManagement_load(game, arg);
+  game_interface_data_set_last_command(*game, command);
+  command_set_lastcmd_success(command, status);
 
   return;
 }
@@ -947,6 +912,7 @@ void game_actions_team(Game *game, char *arg, Graphic_engine *gengine)
   Bool show;
   char previous_message[MAX_MESSAGE], message[MAX_MESSAGE];
   Bool acceptance;
+  Command *command = NULL;
 
   if (!game || !arg)
     return;
@@ -983,26 +949,32 @@ void game_actions_team(Game *game, char *arg, Graphic_engine *gengine)
   }
   current_turn = game_get_turn(game);
 
-  game_set_turn(game, turn);
-  /*copy the previous values for the last command used*/
-  strcpy(previous_message, game_get_message(game, (Protagonists)game_get_turn(game)));
-  show = game_get_show_message(game, (Protagonists)game_get_turn(game));
+  /*The answer is kept as the second argument of the command, a command played again from the journal already has it*/
+  command = game_interface_data_get_cmd_in_pos(game, LAST);
+  if (command_get_argument2(command)[0] == '\0')
+  {
+    game_set_turn(game, turn);
+    /*copy the previous values for the last command used*/
+    strcpy(previous_message, game_get_message(game, (Protagonists)game_get_turn(game)));
+    show = game_get_show_message(game, (Protagonists)game_get_turn(game));
 
-  /*print the message for the other player to accept or decline*/
-  sprintf(message, "Player %d wants to team, accept or decline?(Y/N)", current_turn + 1);
+    /*print the message for the other player to accept or decline*/
+    sprintf(message, "Player %d wants to team, accept or decline?(Y/N)", current_turn + 1);
 
-  game_set_message(game, message, (Protagonists)game_get_turn(game));
-  game_set_show_message(game, TRUE, (Protagonists)game_get_turn(game));
-  /*paint the game in order to see the new message*/
-  graphic_engine_paint_game(gengine, game);
-  /*get the user input*/
-  acceptance = command_get_confirmation();
-
-  /*set the values back */
-  game_set_message(game, previous_message, (Protagonists)game_get_turn(game));
-  game_set_show_message(game, show, (Protagonists)game_get_turn(game));
-  /*get back to the turn*/
-  game_set_turn(game, current_turn);
+    game_set_message(game, message, (Protagonists)game_get_turn(game));
+    game_set_show_message(game, TRUE, (Protagonists)game_get_turn(game));
+    /*paint the game in order to see the new message*/
+    graphic_engine_paint_game(gengine, game);
+    /*get the user input*/
+    command_set_argument2(command, command_get_confirmation() == TRUE ? "Y" : "N");
+
+    /*set the values back */
+    game_set_message(game, previous_message, (Protagonists)game_get_turn(game));
+    game_set_show_message(game, show, (Protagonists)game_get_turn(game));
+    /*get back to the turn*/
+    game_set_turn(game, current_turn);
+  }
+  acceptance = strcmp(command_get_argument2(command), "Y") == 0 ? TRUE : FALSE;
 
   if (acceptance == FALSE)
   {
@@ -22,21 +22,28 @@
 #include "command.h"
 #include "game.h"
 #include "game_rules.h"
+#include "string_pool.h"
+#include "world_template.h"
+#include "journal.h"
 
 #define TIME_BETWEEN_TURNS 1 /*!< Ammount of seconds the game gives each player to visualize their action before changing the turn*/
+#define N_RENDERERS 3        /*!< Number of backends the graphic engine can use*/
 
 /**
- * @brief creates the game structure with the information from a file (calls the game_create_from_file function) and creates the game's graphic engine (calling the graphic_engine_create function)
+ * @brief loads the world from a file once (calls the world_template_create function), creates the game as a copy of it and creates the game's graphic engine (calling the graphic_engine_create function)
  *
  * @author Profesores PPROG
  * @date 27-01-2025
  *
+ * @param world a pointer where the world loaded from the file is stored
  * @param game a pointer to the structure with the game's main information
  * @param gengine a pointer to the game's graphic engine
  * @param file_name a string with the name of the file where the information needed to create the game is stored
+ * @param renderer backend used by the graphic engine to show the game
+ * @param seed the seed of the random numbers of the game
  * @return int: 1 if an error occurs and 0 if no errors occur.
  */
-int game_loop_init(Game **game, Graphic_engine **gengine, char *file_name);
+int game_loop_init(World_template **world, Game **game, Graphic_engine **gengine, char *file_name, Renderer_type renderer, unsigned long seed);
 
 /**
  * @brief runs the game, receiving the user's inputs and painting the graphic interface
@@ -47,23 +54,26 @@ int game_loop_init(Game **game, Graphic_engine **gengine, char *file_name);
  * @param game a double pointer to the structure with the game's main information
  * @param gengine a pointer to the game's graphic engine
  * @param log_file a pointer to the log file
+ * @param journal the journal where the commands are kept, or NULL to play without one
  */
-void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file);
+void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file, Journal *journal);
 
 /**
- * @brief destroys the game and the graphic engine
+ * @brief destroys the world, the game and the graphic engine
  *
  * @author Profesores PPROG
  * @date 27-01-2025
  *
+ * @param world a pointer to the world the game was created from
  * @param game a pointer to the structure with the game's main information
  * @param gengine a pointer to the game's graphic engine
  */
-void game_loop_cleanup(Game *game, Graphic_engine *gengine);
+void game_loop_cleanup(World_template *world, Game *game, Graphic_engine *gengine);
 
 /*****************************************************************************/
 
 int DETERMINIST_MODE = 0; /*!< Initialization of the determinist mode variable */
+char *renderer_to_str[N_RENDERERS] = {"ansi", "null", "digest"}; /*!< Names of the backends of the graphic engine, in the order of Renderer_type */
 /**
  * @brief initializes the game loop (calling the game_loop_init function) and runs the game loop
  *
@@ -76,18 +86,23 @@ int DETERMINIST_MODE = 0; /*!< Initialization of the determinist mode variable *
  */
 int main(int argc, char *argv[])
 {
+  World_template *world = NULL;
   Game *game = NULL;
   Graphic_engine *gengine;
   FILE *log_file = NULL;
+  Journal *journal = NULL;
+  char *journal_name = NULL;
+  unsigned long seed = (unsigned long)time(NULL);
   char filename[MAX_MESSAGE];
-  int i;
+  Renderer_type renderer = ANSI_RENDERER;
+  int i, j;
 
   /*If game data file is missing, the program exits with an error.
   If the game data file is provided but the log file is not, the code will still proceed with the game
   If log file are also provided, logging is enabled*/
   if (argc < 2)
   {
-    fprintf(stderr, "Use: %s <game_data_file> <-l log_file>\n", argv[0]);
+    fprintf(stderr, "Use: %s <game_data_file> <-l log_file> <-d> <-r ansi|null|digest> <-j journal_file> <-s seed>\n", argv[0]);
     return 1;
   }
 
@@ -106,6 +121,33 @@ int main(int argc, char *argv[])
       }
       i += 1;
     }
+    /*The null and digest renderers allow running the game without painting it, for instance in replays*/
+    if (strcasecmp(argv[i], "-r") == 0 && i + 1 < argc)
+    {
+      for (j = 0; j < N_RENDERERS && strcasecmp(argv[i + 1], renderer_to_str[j]) != 0; j++)
+        ;
+      if (j == N_RENDERERS)
+      {
+        fprintf(stderr, "Unknown renderer: |%s|\n", argv[i + 1]);
+        if (log_file)
+          fclose(log_file);
+        return 1;
+      }
+      renderer = (Renderer_type)j;
+      i += 1;
+    }
+    /*With a journal the game can be recovered if it stops before it is saved*/
+    if (strcasecmp(argv[i], "-j") == 0 && i + 1 < argc)
+    {
+      journal_name = argv[i + 1];
+      i += 1;
+    }
+    /*A given seed makes the random numbers of the game the same every time it is played*/
+    if (strcasecmp(argv[i], "-s") == 0 && i + 1 < argc)
+    {
+      seed = strtoul(argv[i + 1], NULL, 10);
+      i += 1;
+    }
   }
   /*at least four arguments provided (the program name, game data file, -l flag, and log file name*/
   /*
@@ -123,12 +165,23 @@ int main(int argc, char *argv[])
   setlocale(LC_ALL, "");
 
   /* initializes the game and the graphic engine using the game data file*/
-  if (!game_loop_init(&game, &gengine, argv[1]))
+  if (!game_loop_init(&world, &game, &gengine, argv[1], renderer, seed))
   {
-    /*runs the game loop, from user inputs and updates the game state. It also logs commands if a log file is given*/
-    game_loop_run(&game, gengine, log_file);
-    game_loop_cleanup(game, gengine);
+    /*If the journal has a game, it goes on from where it was left*/
+    if (journal_name && !(journal = journal_open(journal_name, &game)))
+    {
+      fprintf(stderr, "Error opening the journal: |%s|\n", journal_name);
+    }
+    else
+    {
+      /*runs the game loop, from user inputs and updates the game state. It also logs commands if a log file is given*/
+      game_loop_run(&game, gengine, log_file, journal);
+      journal_close(journal, game_get_finished(game));
+    }
+    game_loop_cleanup(world, game, gengine);
   }
+  /*The texts of the entities are kept in the pool until every game has been destroyed*/
+  string_pool_release();
 
   if (log_file)
   {
@@ -138,30 +191,32 @@ int main(int argc, char *argv[])
   return 0;
 }
 
-/**Yhis function initializes the game, calling the game_create_from_file function with the text file
- * that has been passed as an argument. */
-int game_loop_init(Game **game, Graphic_engine **gengine, char *file_name)
+/**Yhis function initializes the game, loading the world from the text file that has been passed as an argument
+ * (calling the world_template_create function) and copying it. */
+int game_loop_init(World_template **world, Game **game, Graphic_engine **gengine, char *file_name, Renderer_type renderer, unsigned long seed)
 {
-  srand(time(NULL));
-  if (game_create_from_file(game, file_name) == ERROR)
+  /*The world is read only once, a new game is just a copy of its state*/
+  if (!(*world = world_template_create(file_name)) || world_template_new_game(*world, game) == ERROR)
   {
     fprintf(stderr, "Error while initializing game.\n");
-    game_destroy((*game));
+    world_template_destroy(*world);
     return 1;
   }
 
-  if ((*gengine = graphic_engine_create()) == NULL)
+  if ((*gengine = graphic_engine_create(renderer)) == NULL)
   {
     fprintf(stderr, "Error while initializing graphic engine.\n");
     game_destroy((*game));
+    world_template_destroy(*world);
     return 1;
   }
   game_set_current_cinematic(*game, INTRODUCTION);
+  rng_seed(game_get_rng(*game), seed);
   return 0;
 }
 
 /**this function runs the game and calls the necessary functions for this purpose. */
-void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file)
+void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file, Journal *journal)
 {
   Command *last_cmd = NULL;
   CommandCode cmd_code;
@@ -170,6 +225,7 @@ void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file)
   char *cmd_arg2 = NULL;
   extern char *cmd_to_str[N_CMD][N_CMDT];
   Status cmd_status;
+  Bool replaying;
   int i;
 
   if (!gengine)
@@ -181,6 +237,8 @@ void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file)
   {
     /*We create a new command which will be added  in the command history of the player currently playing*/
     last_cmd = command_create();
+    /*The commands of the journal are played again without painting them, as they were played before the game stopped*/
+    replaying = journal_replaying(journal);
 
     /*We play the cinematic if it corresponds to do so*/
     if (game_get_current_cinematic(*game) != NO_CINEMATIC)
@@ -189,8 +247,13 @@ void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file)
       for (i = 0; i < cinematics_get_n_lines(game_get_current_cinematic_text(*game)); i++)
       {
         game_set_message(*game, cinematics_get_line(game_get_current_cinematic_text(*game), i), (Protagonists)game_get_turn(*game));
-        graphic_engine_paint_game(gengine, *game);
-        sleep(TIME_BETWEEN_CINEMATICS);
+        if (replaying == FALSE)
+        {
+          graphic_engine_paint_game(gengine, *game);
+          /*Nobody reads the cinematic when the game is not painted*/
+          if (graphic_engine_get_renderer(gengine) == ANSI_RENDERER)
+            sleep(TIME_BETWEEN_CINEMATICS);
+        }
       }
       game_set_current_cinematic(*game, NO_CINEMATIC);
       game_set_show_message(*game, FALSE, (Protagonists)game_get_turn(*game));
@@ -200,16 +263,42 @@ void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file)
     {
       game_rules_mission_update(*game);
     }
+    /*The result of a save written in the background is told once the file has been written, in determinist mode it is waited for so every run paints the same*/
+    if (game_get_saver(*game) && (DETERMINIST_MODE || gameManagement_save_pending(*game) == FALSE))
+    {
+      if (gameManagement_save_finish(*game) == ERROR)
+      {
+        game_set_message(*game, "The game could not be saved", (Protagonists)game_get_turn(*game));
+        game_set_show_message(*game, TRUE, (Protagonists)game_get_turn(*game));
+      }
+    }
 
-    /*We paint the game for the player whose turn it currently is*/
-    graphic_engine_paint_game(gengine, *game);
-    /*We read the player's command and add it to their command history*/
-    command_get_user_input(last_cmd);
+    if (replaying == TRUE)
+    {
+      journal_next(journal, last_cmd);
+    }
+    else
+    {
+      /*We paint the game for the player whose turn it currently is*/
+      graphic_engine_paint_game(gengine, *game);
+      /*We read the player's command and add it to their command history*/
+      command_get_user_input(last_cmd);
+    }
     game_actions_update(game, last_cmd, gengine);
 
     /*we update the mission state*/
     game_rules_mission_update(*game);
 
+    /*The command is kept in the journal once it has been played, exiting is not kept so the game goes on next time.
+      Saving and loading depend on files out of the journal, so they are not played again: the game a load gives is kept as a checkpoint*/
+    if (journal && replaying == FALSE)
+    {
+      if (command_get_code(last_cmd) == LOAD)
+        journal_checkpoint(journal, *game);
+      else if (command_get_code(last_cmd) != EXIT && command_get_code(last_cmd) != SAVE)
+        journal_append(journal, last_cmd);
+    }
+
     /*If log is enabled*/
     if (log_file)
     {
@@ -255,12 +344,15 @@ void game_loop_run(Game **game, Graphic_engine *gengine, FILE *log_file)
         game_set_finished(*game, TRUE);
       }
     }
+    if (journal)
+      journal_update(journal, *game);
   } while ((command_get_code(game_interface_data_get_cmd_in_pos(*game, LAST)) != EXIT) && (game_get_finished(*game) == FALSE));
 }
 
-/**destroys the game and cleans the textual graphic interface. */
-void game_loop_cleanup(Game *game, Graphic_engine *gengine)
+/**destroys the world, the game and cleans the textual graphic interface. */
+void game_loop_cleanup(World_template *world, Game *game, Graphic_engine *gengine)
 {
+  world_template_destroy(world);
   game_destroy(game);
   graphic_engine_destroy(gengine);
 }
@@ -0,0 +1,197 @@
+/**
+ * @file glyph.c
+ * @author agent
+ * @brief This file implements the functions used to handle the UTF-8 glyphs of the graphic descriptions
+ * @version 0.1
+ * @date 18-10-2026
+ *
+ * @copyright Copyright (c) 2025
+ */
+#include "glyph.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HEXADECIMAL_BASE 16    /*!<Numerical value that corresponds to the base of hexadecimal numbers*/
+#define N_WIDE_RANGES 12       /*!<Number of ranges of codepoints that occupy two columns in the terminal*/
+#define WIDE_CHAR 2            /*!<Number of columns occupied by wide characters*/
+#define NARROW_CHAR 1          /*!<Number of columns occupied by the rest of characters*/
+#define CONTINUATION_MASK 0xC0 /*!<Bits that identify the continuation bytes of an UTF-8 character*/
+#define CONTINUATION_BYTE 0x80 /*!<Value of the identifying bits of the continuation bytes of an UTF-8 character*/
+#define PAYLOAD_BITS 6         /*!<Number of bits of the codepoint stored in each continuation byte*/
+#define PAYLOAD_MASK 0x3F      /*!<Bits of the codepoint stored in each continuation byte*/
+#define MAX_CODEPOINT 0x10FFFF /*!<Highest valid Unicode codepoint*/
+
+/*!<Ranges of codepoints (first and last) that are printed with two columns by the terminal*/
+long wide_ranges[N_WIDE_RANGES][2] = {
+    {0x1100, 0x115F},   /*Hangul Jamo*/
+    {0x2E80, 0xA4CF},   /*CJK*/
+    {0xAC00, 0xD7A3},   /*Hangul syllables*/
+    {0xF900, 0xFAFF},   /*CJK compatibility ideographs*/
+    {0xFE30, 0xFE4F},   /*CJK compatibility forms*/
+    {0xFF00, 0xFF60},   /*Fullwidth forms*/
+    {0xFFE0, 0xFFE6},   /*Fullwidth signs*/
+    {0x1F300, 0x1F64F}, /*Pictographs and emoticons*/
+    {0x1F680, 0x1F6FF}, /*Transport and map symbols*/
+    {0x1F900, 0x1F9FF}, /*Supplemental pictographs*/
+    {0x1FA70, 0x1FAFF}, /*Extended pictographs*/
+    {0x20000, 0x3FFFD}  /*CJK extensions*/
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+int glyph_hex_value(char c);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Status glyph_decode(char *dest, const char *src, int size)
+{
+    int i = 0, j = 0;
+    int high, low;
+
+    if (!dest || !src || size <= 0)
+        return ERROR;
+
+    while (src[i] != '\0' && j < size - 1)
+    {
+        /*An escaped byte is made of the characters '\', 'x' and two hexadecimal values*/
+        if (src[i] == '\\' && src[i + 1] == 'x' && (high = glyph_hex_value(src[i + 2])) != -1 && (low = glyph_hex_value(src[i + 3])) != -1)
+        {
+            dest[j++] = (char)(high * HEXADECIMAL_BASE + low);
+            i += GLYPH_ESCAPE_SIZE;
+        }
+        else
+        {
+            dest[j++] = src[i++];
+        }
+    }
+    dest[j] = '\0';
+
+    return OK;
+}
+
+Status glyph_encode(char *dest, const char *src, int size)
+{
+    int i = 0, j = 0;
+
+    if (!dest || !src || size <= 0)
+        return ERROR;
+
+    for (i = 0; src[i] != '\0'; i++)
+    {
+        if ((unsigned char)src[i] < 0x80 && src[i] != '\\')
+        {
+            if (j + 1 > size - 1)
+                break;
+            dest[j++] = src[i];
+        }
+        else
+        {
+            if (j + GLYPH_ESCAPE_SIZE > size - 1)
+                break;
+            sprintf(dest + j, "\\x%02X", (unsigned char)src[i]);
+            j += GLYPH_ESCAPE_SIZE;
+        }
+    }
+    dest[j] = '\0';
+
+    return src[i] == '\0' ? OK : ERROR;
+}
+
+int glyph_sequence_length(unsigned char lead)
+{
+    if (lead >= 0xF0 && lead <= 0xF7)
+        return 4;
+    if (lead >= 0xE0 && lead <= 0xEF)
+        return 3;
+    if (lead >= 0xC0 && lead <= 0xDF)
+        return 2;
+    return 1;
+}
+
+int glyph_codepoint_width(long codepoint)
+{
+    int i;
+
+    if (codepoint < wide_ranges[0][0])
+        return NARROW_CHAR;
+
+    for (i = 0; i < N_WIDE_RANGES; i++)
+    {
+        if (codepoint >= wide_ranges[i][0] && codepoint <= wide_ranges[i][1])
+            return WIDE_CHAR;
+    }
+    return NARROW_CHAR;
+}
+
+long glyph_utf8_decode(const char *str, int *len)
+{
+    long codepoint = 0;
+    int i, n;
+
+    if (!str || !len)
+        return -1;
+
+    *len = 1;
+    if ((unsigned char)str[0] < CONTINUATION_BYTE)
+        return (unsigned char)str[0];
+
+    n = glyph_sequence_length((unsigned char)str[0]);
+    if (n == 1)
+        return -1;
+
+    codepoint = (unsigned char)str[0] & (0x7F >> n);
+    for (i = 1; i < n; i++)
+    {
+        /*The '\0' is not a continuation byte, so truncated sequences stop here*/
+        if (((unsigned char)str[i] & CONTINUATION_MASK) != CONTINUATION_BYTE)
+            return -1;
+        codepoint = (codepoint << PAYLOAD_BITS) | ((unsigned char)str[i] & PAYLOAD_MASK);
+    }
+    if (codepoint > MAX_CODEPOINT)
+        return -1;
+
+    *len = n;
+    return codepoint;
+}
+
+int glyph_utf8_encode(long codepoint, char *dest)
+{
+    int n, i;
+
+    if (!dest || codepoint < 0 || codepoint > MAX_CODEPOINT)
+        return 0;
+
+    if (codepoint < 0x80)
+    {
+        dest[0] = (char)codepoint;
+        return 1;
+    }
+    n = codepoint < 0x800 ? 2 : (codepoint < 0x10000 ? 3 : 4);
+
+    /*The continuation bytes are filled from the last one, each of them with the lowest 6 bits left*/
+    for (i = n - 1; i > 0; i--)
+    {
+        dest[i] = (char)(CONTINUATION_BYTE | (codepoint & PAYLOAD_MASK));
+        codepoint >>= PAYLOAD_BITS;
+    }
+    /*The lead byte starts with as many ones as bytes has the character*/
+    dest[0] = (char)(((0xFF00 >> n) & 0xFF) | codepoint);
+
+    return n;
+}
+
+/*Returns the value of an hexadecimal digit, or -1 if c is not one*/
+int glyph_hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
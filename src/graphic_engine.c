@@ -8,6 +8,7 @@
  */
 
 #include "graphic_engine.h"
+#include "hash.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -40,6 +41,9 @@
 #define FINAL_CHARACTER 1 /*!<Size corresponding to the \0 character of the string*/
 #define ARROW_SIZE 1      /*!<Size corresponding to the arrow characters*/
 #define MAX_STR 255       /*!<The maximum characters of a line*/
+
+#define DIGEST_VALUE_BYTES 4       /*!<Number of bytes of each value added to the digest*/
+#define BITS_PER_BYTE 8            /*!<Number of bits in a byte*/
 /**
  * @brief Describes the positions of the array that contains each of the rows in the compass area
  * @author Matteo Artunedo
@@ -69,6 +73,10 @@ typedef enum
  */
 struct _Graphic_engine
 {
+  Renderer_type renderer;                        /*!<Backend used to show the game*/
+  void (*paint)(Graphic_engine *ge, Game *game); /*!<Function of the backend that paints each frame*/
+  unsigned long digest;                          /*!<Digest of the game state in the last frame painted by the DIGEST_RENDERER*/
+  Screen *screen;                                /*!<Screen where all of the areas of the graphic engine are placed (NULL for the headless backends)*/
   Area
       *map,      /*!<Map area of the graphic engine. Here we can see the players, objects, spaces, graphical descriptions, etc*/
       *descript, /*!<Description area of the graphic engine. Here the player can get info about the game such as object and character placement, his health, etc*/
@@ -107,6 +115,39 @@ char **graphic_engine_paint_compass(Game *game, Id north, Id south, Id west, Id
  */
 void graphic_interface_paint_feedback_for_pos(Game *game, Graphic_engine *ge, CommandPosition pos, char *str);
 
+/**
+ * @brief Paints all of the areas of the interface in the terminal (ANSI_RENDERER)
+ * @author agent
+ * @param ge pointer to the graphic engine
+ * @param game pointer to the game
+ */
+void graphic_engine_paint_ansi(Graphic_engine *ge, Game *game);
+
+/**
+ * @brief Does not paint anything (NULL_RENDERER), so headless replays are only bounded by the game logic
+ * @author agent
+ * @param ge pointer to the graphic engine
+ * @param game pointer to the game
+ */
+void graphic_engine_paint_null(Graphic_engine *ge, Game *game);
+
+/**
+ * @brief Computes the digest of the game state and prints it in one line (DIGEST_RENDERER)
+ * @author agent
+ * @param ge pointer to the graphic engine
+ * @param game pointer to the game
+ */
+void graphic_engine_paint_digest(Graphic_engine *ge, Game *game);
+
+/**
+ * @brief Adds a value to a FNV-1a digest, byte by byte
+ * @author agent
+ * @param digest the current digest
+ * @param value the value to be added
+ * @return the new digest
+ */
+unsigned long graphic_engine_digest_add(unsigned long digest, long value);
+
 /*PRIVATE FUNCTIONS*/
 char **graphic_engine_paint_compass(Game *game, Id north, Id south, Id west, Id east, Id up, Id down)
 {
@@ -299,30 +340,49 @@ char **graphic_engine_paint_compass(Game *game, Id north, Id south, Id west, Id
 }
 
 /*PUBLIC FUNCTIONS*/
-Graphic_engine *graphic_engine_create()
+Graphic_engine *graphic_engine_create(Renderer_type renderer)
 {
-  static Graphic_engine *ge = NULL;
+  Graphic_engine *ge = NULL;
 
-  if (ge)
+  ge = (Graphic_engine *)calloc(1, sizeof(Graphic_engine));
+  if (ge == NULL)
   {
+    return NULL;
+  }
+
+  ge->renderer = renderer;
+  switch (renderer)
+  {
+  case ANSI_RENDERER:
+    ge->paint = graphic_engine_paint_ansi;
+    break;
+  /*The headless backends do not need the screen nor its areas*/
+  case NULL_RENDERER:
+    ge->paint = graphic_engine_paint_null;
+    return ge;
+  case DIGEST_RENDERER:
+    ge->paint = graphic_engine_paint_digest;
     return ge;
+  default:
+    free(ge);
+    return NULL;
   }
 
-  screen_init(HEIGHT_MAP + HEIGHT_COMPASS + HEIGHT_MISSION + HEIGHT_BAN + HEIGHT_SEPARATOR + HEIGHT_SEPARATOR + HEIGHT_SEPARATOR, WIDTH_MISSION + WIDTH_SEPARATOR + WIDTH_SEPARATOR);
-  ge = (Graphic_engine *)malloc(sizeof(Graphic_engine));
-  if (ge == NULL)
+  ge->screen = screen_init(HEIGHT_MAP + HEIGHT_COMPASS + HEIGHT_MISSION + HEIGHT_BAN + HEIGHT_SEPARATOR + HEIGHT_SEPARATOR + HEIGHT_SEPARATOR, WIDTH_MISSION + WIDTH_SEPARATOR + WIDTH_SEPARATOR);
+  if (ge->screen == NULL)
   {
+    free(ge);
     return NULL;
   }
 
-  ge->map = screen_area_init(WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR, WIDTH_MAP, HEIGHT_MAP);
-  ge->descript = screen_area_init(WIDTH_SEPARATOR + WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_MAP + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR, WIDTH_DES, HEIGHT_DES);
-  ge->dialogue = screen_area_init(1, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR, WIDTH_DIALOGUE, HEIGHT_DIALOGUE);
-  ge->compass = screen_area_init(1, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR + HEIGHT_DIALOGUE + HEIGHT_SEPARATOR, WIDTH_COMPASS, HEIGHT_COMPASS);
-  ge->banner = screen_area_init((int)(halve_length(WIDTH_MISSION)), 0, WIDTH_BAN, HEIGHT_BAN);
-  ge->help = screen_area_init(WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR + HEIGHT_MAP + HEIGHT_SEPARATOR, WIDTH_HLP, HEIGHT_HLP);
-  ge->feedback = screen_area_init(WIDTH_SEPARATOR + WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_MAP + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR + HEIGHT_DES + HEIGHT_SEPARATOR, WIDTH_FEEDBACK, HEIGHT_FDB);
-  ge->mission = screen_area_init(1, HEIGHT_BAN, WIDTH_MISSION, HEIGHT_MISSION);
+  ge->map = screen_area_init(ge->screen, WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR, WIDTH_MAP, HEIGHT_MAP);
+  ge->descript = screen_area_init(ge->screen, WIDTH_SEPARATOR + WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_MAP + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR, WIDTH_DES, HEIGHT_DES);
+  ge->dialogue = screen_area_init(ge->screen, 1, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR, WIDTH_DIALOGUE, HEIGHT_DIALOGUE);
+  ge->compass = screen_area_init(ge->screen, 1, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR + HEIGHT_DIALOGUE + HEIGHT_SEPARATOR, WIDTH_COMPASS, HEIGHT_COMPASS);
+  ge->banner = screen_area_init(ge->screen, (int)(halve_length(WIDTH_MISSION)), 0, WIDTH_BAN, HEIGHT_BAN);
+  ge->help = screen_area_init(ge->screen, WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR + HEIGHT_MAP + HEIGHT_SEPARATOR, WIDTH_HLP, HEIGHT_HLP);
+  ge->feedback = screen_area_init(ge->screen, WIDTH_SEPARATOR + WIDTH_DIALOGUE + WIDTH_SEPARATOR + WIDTH_MAP + WIDTH_SEPARATOR, HEIGHT_BAN + HEIGHT_MISSION + HEIGHT_SEPARATOR + HEIGHT_DES + HEIGHT_SEPARATOR, WIDTH_FEEDBACK, HEIGHT_FDB);
+  ge->mission = screen_area_init(ge->screen, 1, HEIGHT_BAN, WIDTH_MISSION, HEIGHT_MISSION);
 
   return ge;
 }
@@ -341,11 +401,107 @@ void graphic_engine_destroy(Graphic_engine *ge)
   screen_area_destroy(ge->feedback);
   screen_area_destroy(ge->mission);
 
-  screen_destroy();
+  screen_destroy(ge->screen);
   free(ge);
 }
 
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
+{
+  if (!ge || !game)
+    return;
+
+  ge->paint(ge, game);
+}
+
+Renderer_type graphic_engine_get_renderer(Graphic_engine *ge)
+{
+  if (!ge)
+    return ANSI_RENDERER;
+
+  return ge->renderer;
+}
+
+unsigned long graphic_engine_get_digest(Graphic_engine *ge)
+{
+  if (!ge)
+    return 0;
+
+  return ge->digest;
+}
+
+void graphic_engine_paint_null(Graphic_engine *ge, Game *game)
+{
+  return;
+}
+
+void graphic_engine_paint_digest(Graphic_engine *ge, Game *game)
+{
+  Player *player = NULL;
+  Object *object = NULL;
+  Character *character = NULL;
+  Link *link = NULL;
+  unsigned long digest = HASH_START;
+  int i;
+
+  digest = graphic_engine_digest_add(digest, game_get_turn(game));
+  digest = graphic_engine_digest_add(digest, game_get_lights_on(game));
+  digest = graphic_engine_digest_add(digest, game_get_finished(game));
+  digest = graphic_engine_digest_add(digest, game_get_current_mission_code(game));
+
+  for (i = 0; i < game_get_n_players(game); i++)
+  {
+    player = game_get_player_in_pos(game, i);
+    digest = graphic_engine_digest_add(digest, player_get_id(player));
+    digest = graphic_engine_digest_add(digest, player_get_location(player));
+    digest = graphic_engine_digest_add(digest, player_get_health(player));
+    digest = graphic_engine_digest_add(digest, player_get_team(player));
+  }
+
+  for (i = 0; i < game_get_n_objects(game); i++)
+  {
+    object = game_get_object_in_pos(game, i);
+    digest = graphic_engine_digest_add(digest, object_get_id(object));
+    digest = graphic_engine_digest_add(digest, game_get_object_location(game, object_get_id(object)));
+    digest = graphic_engine_digest_add(digest, object_get_open(object));
+    digest = graphic_engine_digest_add(digest, object_get_health(object));
+  }
+
+  for (i = 0; i < game_get_n_characters(game); i++)
+  {
+    character = game_get_character_in_pos(game, i);
+    digest = graphic_engine_digest_add(digest, character_get_id(character));
+    digest = graphic_engine_digest_add(digest, character_get_location(character));
+    digest = graphic_engine_digest_add(digest, character_get_health(character));
+    digest = graphic_engine_digest_add(digest, character_get_friendly(character));
+    digest = graphic_engine_digest_add(digest, character_get_following(character));
+  }
+
+  for (i = 0; i < game_get_n_links(game); i++)
+  {
+    link = game_get_link_in_pos(game, i);
+    digest = graphic_engine_digest_add(digest, link_get_id(link));
+    digest = graphic_engine_digest_add(digest, link_get_is_open(link));
+  }
+
+  ge->digest = digest;
+  printf("%08lx\n", digest);
+}
+
+unsigned long graphic_engine_digest_add(unsigned long digest, long value)
+{
+  char bytes[DIGEST_VALUE_BYTES];
+  int i;
+
+  /*The lowest bytes are added first, so the digest does not depend on the size nor the endianness of long*/
+  for (i = 0; i < DIGEST_VALUE_BYTES; i++)
+  {
+    bytes[i] = (char)((value >> (i * BITS_PER_BYTE)) & 0xFFL);
+  }
+
+  return hash_bytes(digest, bytes, DIGEST_VALUE_BYTES);
+}
+
+void graphic_engine_paint_ansi(Graphic_engine *ge, Game *game)
 {
   Id id_act = NO_ID, obj_loc = NO_ID, character_loc = NO_ID, id_north = NO_ID, id_south = NO_ID, id_east = NO_ID, id_west = NO_ID, id_up = NO_ID, id_down = NO_ID, character_following = NO_ID, open_id = NO_ID, depend_id = NO_ID;
   char **map_information = NULL, **compass_information = NULL;
@@ -622,7 +778,7 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
   }
 
   /* Dump to the terminal */
-  screen_paint((game_get_turn(game)), game_get_lights_on(game));
+  screen_paint(ge->screen, (game_get_turn(game)), game_get_lights_on(game));
   printf("prompt:> ");
 }
 
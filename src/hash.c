@@ -0,0 +1,26 @@
+/**
+ * @brief It implements the hash used by the tables, the checksums and the digests of the game
+ *
+ * @file hash.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "hash.h"
+
+#define HASH_PRIME 16777619UL /*!<Value the hash is multiplied by after each byte*/
+#define HASH_MASK 0xFFFFFFFFUL /*!<The hash is kept in 32 bits*/
+
+unsigned long hash_bytes(unsigned long hash, const char *data, long size)
+{
+  long i;
+
+  for (i = 0; i < size; i++)
+  {
+    hash = ((hash ^ (unsigned char)data[i]) * HASH_PRIME) & HASH_MASK;
+  }
+
+  return hash;
+}
@@ -21,8 +21,10 @@
  */
 struct _Inventory
 {
-  Set *objs;    /*!< Set of objects in the player's backpack */
-  int max_objs; /*!< max number of objects in the player's backpack */
+  Set *objs;                 /*!< Set of objects in the player's backpack */
+  int max_objs;              /*!< max number of objects in the player's backpack */
+  Location_index *locations; /*!< Index where the objects added to the backpack are recorded, NULL if there is none */
+  Id owner;                  /*!< Id of the player the backpack belongs to */
 };
 
 Inventory *inventory_create(int max_objs)
@@ -52,10 +54,32 @@ Inventory *inventory_create(int max_objs)
 
   /*set the maximum number of objects*/
   new_inventory->max_objs = max_objs;
+  new_inventory->locations = NULL;
+  new_inventory->owner = NO_ID;
 
   return new_inventory;
 }
 
+Inventory *inventory_copy(Inventory *inventory)
+{
+  Inventory *copy = NULL;
+
+  if (!inventory || !(copy = (Inventory *)malloc(sizeof(Inventory))))
+  {
+    return NULL;
+  }
+
+  *copy = *inventory;
+  copy->locations = NULL;
+  if (!(copy->objs = set_copy_in_arena(NULL, inventory->objs)))
+  {
+    free(copy);
+    return NULL;
+  }
+
+  return copy;
+}
+
 Status inventory_destroy(Inventory *inventory)
 {
   if (!inventory)
@@ -107,7 +131,8 @@ Status inventory_set_objs(Inventory *inventory, Set *objs)
     return ERROR;
   }
   inventory->objs = objs;
-  return OK;
+  /*the objects of the new set are recorded in the index, if there is one*/
+  return inventory_set_location_index(inventory, inventory->locations, inventory->owner);
 }
 
 Status inventory_set_max_objs(Inventory *inventory, int max_objs)
@@ -170,7 +195,14 @@ Status inventory_add_object_id(Inventory *inventory, Id obj_id)
     return ERROR;
   }
 
-  return set_add(inventory->objs, obj_id);
+  if (set_add(inventory->objs, obj_id) == ERROR)
+  {
+    return ERROR;
+  }
+
+  /*the index is told that the object is now in this backpack*/
+  location_index_set(inventory->locations, obj_id, IN_BACKPACK, inventory->owner);
+  return OK;
 }
 
 Status inventory_del_object_id(Inventory *inventory, Id obj_id)
@@ -180,7 +212,13 @@ Status inventory_del_object_id(Inventory *inventory, Id obj_id)
     return ERROR;
   }
 
-  return set_del(inventory->objs, obj_id);
+  if (set_del(inventory->objs, obj_id) == ERROR)
+  {
+    return ERROR;
+  }
+
+  location_index_remove(inventory->locations, obj_id, IN_BACKPACK, inventory->owner);
+  return OK;
 }
 
 Status inventory_print(Inventory *inventory)
@@ -222,3 +260,22 @@ Status inventory_print(Inventory *inventory)
 
   return OK;
 }
+
+Status inventory_set_location_index(Inventory *inventory, Location_index *index, Id owner)
+{
+  int i;
+
+  if (!inventory)
+  {
+    return ERROR;
+  }
+
+  inventory->locations = index;
+  inventory->owner = owner;
+  for (i = 0; i < set_get_num_elements(inventory->objs); i++)
+  {
+    location_index_set(index, set_get_Id_in_pos(inventory->objs, i), IN_BACKPACK, owner);
+  }
+
+  return OK;
+}
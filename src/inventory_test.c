@@ -14,7 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 32 /*!<The total number of tests that can be run*/
+#define MAX_TESTS 37 /*!<The total number of tests that can be run*/
 
 /**
  * @brief Main function for INVENTORY unit tests.
@@ -111,6 +111,16 @@ int main(int argc, char **argv)
         test2_inventory_del_object_id();
     if (all || test == 32)
         test3_inventory_del_object_id();
+    if (all || test == 33)
+        test1_inventory_set_location_index();
+    if (all || test == 34)
+        test2_inventory_set_location_index();
+    if (all || test == 35)
+        test3_inventory_set_location_index();
+    if (all || test == 36)
+        test4_inventory_set_location_index();
+    if (all || test == 37)
+        test1_inventory_copy();
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -474,3 +484,65 @@ void test3_inventory_del_object_id()
     result = inventory_del_object_id(NULL, 1);
     PRINT_TEST_RESULT(result == ERROR);
 }
+
+/**tests if inventory_set_location_index records in the index the objects the inventory already has */
+void test1_inventory_set_location_index()
+{
+    Inventory *inventory = NULL;
+    Location_index *index = location_index_create();
+    Id owner = NO_ID;
+    inventory = inventory_create(10);
+    inventory_add_object_id(inventory, 1);
+    PRINT_TEST_RESULT(inventory_set_location_index(inventory, index, 2) == OK && location_index_get(index, 1, &owner) == IN_BACKPACK && owner == 2);
+    inventory_destroy(inventory);
+    location_index_destroy(index);
+}
+
+/**tests if inventory_set_location_index correctly returns ERROR when the inventory pointer is NULL */
+void test2_inventory_set_location_index()
+{
+    Location_index *index = location_index_create();
+    PRINT_TEST_RESULT(inventory_set_location_index(NULL, index, 2) == ERROR);
+    location_index_destroy(index);
+}
+
+/**tests if the objects added to the inventory are recorded in its index */
+void test3_inventory_set_location_index()
+{
+    Inventory *inventory = NULL;
+    Location_index *index = location_index_create();
+    Id owner = NO_ID;
+    inventory = inventory_create(10);
+    inventory_set_location_index(inventory, index, 2);
+    inventory_add_object_id(inventory, 1);
+    PRINT_TEST_RESULT(location_index_get(index, 1, &owner) == IN_BACKPACK && owner == 2);
+    inventory_destroy(inventory);
+    location_index_destroy(index);
+}
+
+/**tests if the objects removed from the inventory are no longer anywhere in its index */
+void test4_inventory_set_location_index()
+{
+    Inventory *inventory = NULL;
+    Location_index *index = location_index_create();
+    Id owner = NO_ID;
+    inventory = inventory_create(10);
+    inventory_set_location_index(inventory, index, 2);
+    inventory_add_object_id(inventory, 1);
+    inventory_del_object_id(inventory, 1);
+    PRINT_TEST_RESULT(location_index_get(index, 1, &owner) == NOWHERE && owner == NO_ID);
+    inventory_destroy(inventory);
+    location_index_destroy(index);
+}
+
+/**tests if the copy of an inventory keeps its objects after the inventory changes */
+void test1_inventory_copy()
+{
+    Inventory *inventory = inventory_create(10), *copy = NULL;
+    inventory_add_object_id(inventory, 1);
+    copy = inventory_copy(inventory);
+    inventory_del_object_id(inventory, 1);
+    PRINT_TEST_RESULT(copy != NULL && inventory_contains(copy, 1) == TRUE && inventory_get_max_objs(copy) == 10);
+    inventory_destroy(inventory);
+    inventory_destroy(copy);
+}
@@ -0,0 +1,489 @@
+/**
+ * @brief It implements the journal of a game
+ *
+ * @file journal.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "journal.h"
+#include "gameManagement.h"
+#include "snapshot.h"
+#include "saver.h"
+#include "hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define JOURNAL_MAGIC "GAMEJRNL"       /*!<First bytes of every journal*/
+#define JOURNAL_MAGIC_SIZE 8           /*!<Number of bytes of the magic, without the '\0'*/
+#define JOURNAL_BYTE_ORDER 0x01020304L /*!<Value written in the header to detect journals written with another byte order*/
+#define CHECKPOINT_SUFFIX_SIZE 3       /*!<Number of bytes added to the name of the journal to get the name of a checkpoint, with the '\0'*/
+
+/**
+ * @brief Header at the start of every journal
+ * @author agent
+ */
+typedef struct
+{
+  char magic[JOURNAL_MAGIC_SIZE]; /*!<JOURNAL_MAGIC*/
+  long version;                   /*!<JOURNAL_VERSION of the game that wrote it*/
+  long byte_order;                /*!<JOURNAL_BYTE_ORDER, as written by the game that wrote it*/
+  unsigned long world;            /*!<Hash of the world the game was started with, see snapshot_world_hash*/
+  long checkpoint;                /*!<Number of the checkpoint the commands are played after, 0 if they are played from the start*/
+  unsigned long random[RNG_STATE_SIZE]; /*!<State of the random numbers of the game when the commands start*/
+} Journal_header;
+
+/**
+ * @brief Record of a command, followed by its two arguments with their '\0'
+ * @author agent
+ */
+typedef struct
+{
+  long size;              /*!<Size of the record, with the arguments*/
+  unsigned long checksum; /*!<Checksum of every byte of the record after it*/
+  long code;              /*!<Code of the command*/
+} Journal_record;
+
+/**
+ * @brief Journal
+ *
+ * The positions are bytes of the journal file: the commands from replay_pos to replay_end are still to be played again,
+ *  and everything before played is already in the game.
+ * @author agent
+ */
+struct _Journal
+{
+  char *filename;        /*!<Name of the journal*/
+  int fd;                /*!<Descriptor of the journal, open to append*/
+  unsigned long world;   /*!<Hash of the world of the game*/
+  long checkpoint;       /*!<Number of the last checkpoint written*/
+  long size;             /*!<Size of the journal file*/
+  long played;           /*!<Position up to which the commands of the journal are in the game*/
+  char *replay;          /*!<Contents of the journal when it was opened, while there are commands to play again*/
+  long replay_pos;       /*!<Position of the next command to play again*/
+  long replay_end;       /*!<Position where the commands to play again end*/
+  int turns;             /*!<Number of commands played since the last checkpoint was started*/
+  Saver *saver;          /*!<Checkpoint being written, NULL if there is none*/
+  long saver_played;     /*!<Position up to which the commands are in the checkpoint being written*/
+  unsigned long saver_random[RNG_STATE_SIZE]; /*!<State of the random numbers in the checkpoint being written*/
+};
+
+/*Private functions*/
+
+/**
+ * @brief Gets the name of a checkpoint of a journal
+ * @author agent
+ * @param journal the journal
+ * @param checkpoint the number of the checkpoint, only its parity matters
+ * @return the name, it must be freed with free, or NULL in case of error
+ */
+char *journal_checkpoint_name(Journal *journal, long checkpoint);
+
+/**
+ * @brief Fills the header of a journal
+ * @author agent
+ * @param header the header
+ * @param world the hash of the world
+ * @param checkpoint the number of the checkpoint the commands are played after
+ * @param random the state of the random numbers of the game when the commands start
+ */
+void journal_fill_header(Journal_header *header, unsigned long world, long checkpoint, unsigned long *random);
+
+/**
+ * @brief Gets the size of the command that starts at a position of a journal, checking it is complete and not corrupted
+ * @author agent
+ * @param data the contents of the journal
+ * @param pos the position of the command
+ * @param size the size of the journal
+ * @return the size of the record of the command, or 0 if there is no valid command there
+ */
+long journal_record_check(char *data, long pos, long size);
+
+/**
+ * @brief Reads the journal file when it is opened: checks its header, takes the game to its checkpoint and drops the incomplete command at the end
+ * @author agent
+ * @param journal the journal, with its file already open
+ * @param game a pointer to the game
+ * @return Status OK or ERROR
+ */
+Status journal_read(Journal *journal, Game **game);
+
+/**
+ * @brief Starts writing a checkpoint of the game
+ * @author agent
+ * @param journal the journal
+ * @param game the game
+ * @return Status OK or ERROR
+ */
+Status journal_checkpoint_start(Journal *journal, Game *game);
+
+/**
+ * @brief Waits for the checkpoint being written and, once it is on disk, rewrites the journal without the commands it has
+ * @author agent
+ *
+ * The journal is rewritten at once, so if the game stops before, the journal still goes with the previous checkpoint, which is the other file.
+ * @param journal the journal
+ * @return Status OK or ERROR
+ */
+Status journal_checkpoint_finish(Journal *journal);
+
+/*End of private functions*/
+
+Journal *journal_open(char *filename, Game **game)
+{
+  Journal *journal = NULL;
+  Journal_header header;
+  unsigned long random[RNG_STATE_SIZE];
+
+  if (!filename || !game || !(*game))
+    return NULL;
+
+  if (!(journal = (Journal *)calloc(1, sizeof(Journal))))
+    return NULL;
+  if (!(journal->filename = (char *)malloc(strlen(filename) + 1)))
+  {
+    free(journal);
+    return NULL;
+  }
+  strcpy(journal->filename, filename);
+  journal->world = snapshot_world_hash(*game);
+  journal->fd = open(filename, O_RDWR | O_APPEND);
+
+  /*A new journal is written at once with only its header*/
+  if (journal->fd == -1)
+  {
+    rng_get_state(game_get_rng(*game), random);
+    journal_fill_header(&header, journal->world, 0, random);
+    if (saver_write((char *)&header, sizeof(Journal_header), filename) == ERROR || (journal->fd = open(filename, O_RDWR | O_APPEND)) == -1)
+    {
+      journal_close(journal, FALSE);
+      return NULL;
+    }
+    journal->size = journal->played = sizeof(Journal_header);
+    return journal;
+  }
+
+  if (journal_read(journal, game) == ERROR)
+  {
+    journal_close(journal, FALSE);
+    return NULL;
+  }
+  return journal;
+}
+
+void journal_close(Journal *journal, Bool finished)
+{
+  char *name = NULL;
+  int i;
+
+  if (!journal)
+    return;
+
+  if (journal->saver)
+    journal_checkpoint_finish(journal);
+  if (journal->fd != -1)
+    close(journal->fd);
+
+  /*A finished game cannot be recovered, nothing is left for it*/
+  if (finished == TRUE)
+  {
+    remove(journal->filename);
+    for (i = 0; i < 2; i++)
+    {
+      if ((name = journal_checkpoint_name(journal, i)))
+      {
+        remove(name);
+        free(name);
+      }
+    }
+  }
+
+  free(journal->replay);
+  free(journal->filename);
+  free(journal);
+}
+
+Bool journal_replaying(Journal *journal)
+{
+  if (!journal || journal->replay_pos >= journal->replay_end)
+    return FALSE;
+  return TRUE;
+}
+
+Status journal_next(Journal *journal, Command *command)
+{
+  Journal_record record;
+  char *argument = NULL;
+
+  if (!command || journal_replaying(journal) == FALSE)
+    return ERROR;
+
+  memcpy(&record, journal->replay + journal->replay_pos, sizeof(Journal_record));
+  argument = journal->replay + journal->replay_pos + sizeof(Journal_record);
+  command_set_code(command, (CommandCode)record.code);
+  command_set_argument(command, argument);
+  command_set_argument2(command, argument + strlen(argument) + 1);
+
+  journal->replay_pos += record.size;
+  journal->played = journal->replay_pos;
+  journal->turns++;
+
+  /*Once everything has been played again the contents are not needed anymore*/
+  if (journal->replay_pos >= journal->replay_end)
+  {
+    free(journal->replay);
+    journal->replay = NULL;
+    journal->replay_pos = journal->replay_end = 0;
+  }
+  return OK;
+}
+
+Status journal_append(Journal *journal, Command *command)
+{
+  char data[sizeof(Journal_record) + 2 * ARG_LENGTH];
+  Journal_record record;
+  char *argument = NULL, *argument2 = NULL;
+  long n;
+
+  if (!journal || !command || journal->fd == -1)
+    return ERROR;
+
+  argument = command_get_argument(command);
+  argument2 = command_get_argument2(command);
+  record.size = sizeof(Journal_record) + strlen(argument) + strlen(argument2) + 2;
+  record.code = command_get_code(command);
+  strcpy(data + sizeof(Journal_record), argument);
+  strcpy(data + sizeof(Journal_record) + strlen(argument) + 1, argument2);
+  memcpy(data, &record, sizeof(Journal_record));
+  record.checksum = hash_bytes(HASH_START, data + sizeof(long) + sizeof(unsigned long), record.size - sizeof(long) - sizeof(unsigned long));
+  memcpy(data, &record, sizeof(Journal_record));
+
+  /*A single write, if the game stops in the middle the command is dropped when the journal is opened again*/
+  if ((n = (long)write(journal->fd, data, record.size)) != record.size)
+  {
+    /*The commands after a part of one would be dropped, so nothing else is written*/
+    if (n > 0)
+    {
+      close(journal->fd);
+      journal->fd = -1;
+    }
+    return ERROR;
+  }
+  journal->size += record.size;
+  journal->played = journal->size;
+  journal->turns++;
+  return OK;
+}
+
+Status journal_update(Journal *journal, Game *game)
+{
+  Status status = OK;
+
+  if (!journal || !game)
+    return ERROR;
+
+  if (journal->saver && saver_is_done(journal->saver) == TRUE)
+    status = journal_checkpoint_finish(journal);
+  /*The journal is not rewritten while its commands are being played again*/
+  if (!journal->saver && journal->turns >= JOURNAL_CHECKPOINT_TURNS && journal_replaying(journal) == FALSE)
+  {
+    if (journal_checkpoint_start(journal, game) == ERROR)
+      status = ERROR;
+  }
+  return status;
+}
+
+Status journal_checkpoint(Journal *journal, Game *game)
+{
+  Status status = OK;
+
+  if (!journal || !game)
+    return ERROR;
+
+  /*The checkpoint being written has an older game, it is finished first so the new one is the last*/
+  if (journal->saver && journal_checkpoint_finish(journal) == ERROR)
+    status = ERROR;
+  if (journal_checkpoint_start(journal, game) == ERROR || journal_checkpoint_finish(journal) == ERROR)
+    status = ERROR;
+  return status;
+}
+
+char *journal_checkpoint_name(Journal *journal, long checkpoint)
+{
+  char *name = NULL;
+
+  if (!(name = (char *)malloc(strlen(journal->filename) + CHECKPOINT_SUFFIX_SIZE)))
+    return NULL;
+  sprintf(name, "%s.%ld", journal->filename, checkpoint % 2);
+  return name;
+}
+
+void journal_fill_header(Journal_header *header, unsigned long world, long checkpoint, unsigned long *random)
+{
+  int i;
+
+  memset(header, 0, sizeof(Journal_header));
+  memcpy(header->magic, JOURNAL_MAGIC, JOURNAL_MAGIC_SIZE);
+  header->version = JOURNAL_VERSION;
+  header->byte_order = JOURNAL_BYTE_ORDER;
+  header->world = world;
+  header->checkpoint = checkpoint;
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+    header->random[i] = random[i];
+}
+
+long journal_record_check(char *data, long pos, long size)
+{
+  Journal_record record;
+  char *argument = NULL;
+  long length;
+
+  if (size - pos < (long)sizeof(Journal_record))
+    return 0;
+  memcpy(&record, data + pos, sizeof(Journal_record));
+  if (record.size < (long)sizeof(Journal_record) + 2 || record.size > size - pos || record.size > (long)sizeof(Journal_record) + 2 * ARG_LENGTH)
+    return 0;
+  if (record.code < NO_CMD || record.code >= NO_CMD + N_CMD)
+    return 0;
+
+  /*Both arguments must end inside the record and fit in a command*/
+  argument = data + pos + sizeof(Journal_record);
+  length = record.size - sizeof(Journal_record);
+  if (argument[length - 1] != '\0' || (long)strlen(argument) >= ARG_LENGTH || (long)strlen(argument) + 1 >= length || (long)strlen(argument + strlen(argument) + 1) >= ARG_LENGTH)
+    return 0;
+
+  if (hash_bytes(HASH_START, data + pos + sizeof(long) + sizeof(unsigned long), record.size - sizeof(long) - sizeof(unsigned long)) != record.checksum)
+    return 0;
+  return record.size;
+}
+
+Status journal_read(Journal *journal, Game **game)
+{
+  Journal_header header;
+  struct stat info;
+  char *name = NULL;
+  long pos, n, record_size;
+  Status status;
+
+  if (fstat(journal->fd, &info) == -1 || info.st_size < (off_t)sizeof(Journal_header))
+    return ERROR;
+  if (!(journal->replay = (char *)malloc(info.st_size)))
+    return ERROR;
+  for (pos = 0; pos < (long)info.st_size; pos += n)
+  {
+    if ((n = (long)read(journal->fd, journal->replay + pos, info.st_size - pos)) <= 0)
+      return ERROR;
+  }
+
+  memcpy(&header, journal->replay, sizeof(Journal_header));
+  if (memcmp(header.magic, JOURNAL_MAGIC, JOURNAL_MAGIC_SIZE) != 0 || header.version != JOURNAL_VERSION || header.byte_order != JOURNAL_BYTE_ORDER)
+    return ERROR;
+  if (header.world != journal->world || header.checkpoint < 0)
+    return ERROR;
+
+  /*The commands are played after the checkpoint, which was written from the same world, or from the start with the random numbers the game had*/
+  journal->checkpoint = header.checkpoint;
+  if (journal->checkpoint == 0 && rng_set_state(game_get_rng(*game), header.random) == ERROR)
+    return ERROR;
+  if (journal->checkpoint > 0)
+  {
+    if (!(name = journal_checkpoint_name(journal, journal->checkpoint)))
+      return ERROR;
+    status = gameManagement_load(game, name);
+    free(name);
+    if (status == ERROR)
+      return ERROR;
+  }
+
+  /*The commands end where one is incomplete or corrupted, what follows was being written when the game stopped*/
+  for (pos = sizeof(Journal_header); (record_size = journal_record_check(journal->replay, pos, (long)info.st_size)) > 0; pos += record_size)
+    ;
+  if (pos < (long)info.st_size)
+  {
+    if (saver_write(journal->replay, pos, journal->filename) == ERROR)
+      return ERROR;
+    close(journal->fd);
+    if ((journal->fd = open(journal->filename, O_RDWR | O_APPEND)) == -1)
+      return ERROR;
+  }
+
+  journal->size = journal->replay_end = pos;
+  journal->played = journal->replay_pos = sizeof(Journal_header);
+  if (journal_replaying(journal) == FALSE)
+  {
+    free(journal->replay);
+    journal->replay = NULL;
+    journal->replay_pos = journal->replay_end = 0;
+  }
+  return OK;
+}
+
+Status journal_checkpoint_start(Journal *journal, Game *game)
+{
+  char *data = NULL, *name = NULL;
+  long size;
+
+  journal->turns = 0;
+  if (!(name = journal_checkpoint_name(journal, journal->checkpoint + 1)))
+    return ERROR;
+  if (snapshot_build(game, &data, &size) == ERROR)
+  {
+    free(name);
+    return ERROR;
+  }
+  /*The checkpoint goes to the file the journal does not depend on*/
+  journal->saver = saver_start(data, size, name, NULL);
+  free(name);
+  if (!journal->saver)
+    return ERROR;
+  journal->saver_played = journal->played;
+  rng_get_state(game_get_rng(game), journal->saver_random);
+  return OK;
+}
+
+Status journal_checkpoint_finish(Journal *journal)
+{
+  Journal_header header;
+  char *data = NULL;
+  long tail, pos, n;
+  Status status;
+
+  status = saver_finish(journal->saver);
+  journal->saver = NULL;
+  if (status == ERROR || journal->fd == -1)
+    return ERROR;
+
+  /*The commands played after the checkpoint was taken are kept*/
+  tail = journal->size - journal->saver_played;
+  if (!(data = (char *)malloc(sizeof(Journal_header) + tail)))
+    return ERROR;
+  journal_fill_header(&header, journal->world, journal->checkpoint + 1, journal->saver_random);
+  memcpy(data, &header, sizeof(Journal_header));
+  if (lseek(journal->fd, journal->saver_played, SEEK_SET) == -1)
+    status = ERROR;
+  for (pos = 0; pos < tail && status == OK; pos += n)
+  {
+    if ((n = (long)read(journal->fd, data + sizeof(Journal_header) + pos, tail - pos)) <= 0)
+      status = ERROR;
+  }
+  if (status == OK)
+    status = saver_write(data, sizeof(Journal_header) + tail, journal->filename);
+  free(data);
+  if (status == ERROR)
+    return ERROR;
+
+  close(journal->fd);
+  journal->checkpoint++;
+  journal->size = sizeof(Journal_header) + tail;
+  journal->played = journal->played - journal->saver_played + sizeof(Journal_header);
+  if ((journal->fd = open(journal->filename, O_RDWR | O_APPEND)) == -1)
+    return ERROR;
+  return OK;
+}
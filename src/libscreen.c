@@ -1,172 +1,396 @@
 #include "libscreen.h"
+#include "glyph.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
 /*This line makes the compiler ignore all the possible warnings that may arise with the flag -Wpedantic*/
 #pragma GCC diagnostic ignored "-Wpedantic"
 
-/* Global variables */
-int ROWS = 23;    /*!<Number of total rows in the game's screen*/
-int COLUMNS = 80; /*!<Number of total columns in the game's screen*/
-
-#define TOTAL_DATA (ROWS * COLUMNS) + 1             /*!<Total ammount of characters in the screen with extra space for NULL termination*/
-#define BG_CHAR '~'                                 /*!<Value which corresponds to painting the background*/
-#define FG_CHAR ' '                                 /*!<Value which corresponds to painting the foreground*/
-#define ACCESS(d, x, y) (d + ((y) * COLUMNS) + (x)) /*!<Macro function that returns a determined position (x,y) with respects to a certain cursor (d, which is usually a pointer to the data that we want to access)*/
-#define FINAL_CHARACTER 1                           /*!<Size of the '\0' character that limits the size of strings*/
-#define SIZE_IN_CHAR_TWO_HEXADECIMAL_VALUES 2       /*!<Size two hexadecimal values occupy in a string, with each hexadecimal value corresponding to a character*/
-#define SIZE_OF_CONVERTED_UNCODE_SEQ 4              /*!<Size of a UNICODE sequence string that has been converted to its corresponding code, with the '\0' at the end*/
-#define N_ESCAPE_SEQ 4                              /*!<Number of escape sequences that are found in a UNICODE sequence, for instance, \xF0\x9F\x91\xA9 has 4 escape sequences*/
-#define HEXADECIMAL_BASE 16                         /*!<Numerical value that corresponds to the base of hexadecimal numbers*/
-#define EMOTICON_SIZE 1                             /*!<Represents the size of the special UNICODE character in the terminal*/
-#define NEXT_POSITION 1                             /*!<Represents the number of positions advanced when desiring to move to the next position in an array*/
-#define STARTING_POSITION 0                         /*!<Represents the initial position in an array*/
-#define TOTAL_HORIZONTAL_SEPARATORS 4               /*!<Represents the number of separating characters that are found in a line*/
-#define SEPARATOR_LINE_AFTER_MAP 3                  /*!<Represents that the separator line that is found after the map area is the second one out of the total*/
-#define START_ESCAPE_SEQUENCE "\\x"                 /*!<Represents the start of escape sequences for unicode */
+#define TOTAL_DATA(s) ((s)->rows * (s)->columns)           /*!<Total ammount of cells in the screen s*/
+#define BG_CHAR '~'                                        /*!<Value which corresponds to painting the background*/
+#define FG_CHAR ' '                                        /*!<Value which corresponds to painting the foreground*/
+#define ACCESS(s, x, y) (((y) * (s)->columns) + (x))       /*!<Macro function that returns the index of the cell in a determined position (x,y) of the screen s*/
+#define NEXT_POSITION 1                                    /*!<Represents the number of positions advanced when desiring to move to the next position in an array*/
+#define STARTING_POSITION 0                                /*!<Represents the initial position in an array*/
+#define FRAME_BYTES_PER_CELL 4                             /*!<Initial estimation of the bytes each cell of the screen takes in the output frame (escape sequences included)*/
+#define RESET_ATTRIBUTES "\033[0m"                         /*!<SGR sequence that resets the attributes of the terminal*/
+#define LIGHT_THEME_CODE "\033[0;30;47m"                   /*!<SGR sequence for the text cells when the lights are on*/
+#define DARK_THEME_CODE "\033[0;37;40m"                    /*!<SGR sequence for the text cells when the lights are off*/
+#define CLEAR_SCREEN "\033[H\033[2J"                       /*!<Sequence that moves the cursor to the top left corner and clears the terminal*/
+#define CLEAR_TO_END "\033[J"                              /*!<Sequence that clears the terminal from the cursor to the end of the screen*/
+#define MAX_CURSOR_SEQ 32                                  /*!<Maximum size of a cursor positioning sequence*/
+#define MAX_SPAN_GAP 8                                     /*!<Maximum number of unchanged cells painted again to join two changed spans of a row, instead of moving the cursor*/
+#define INVALID_CHAR '?'                                   /*!<Character printed instead of the bytes that are not part of a valid UTF-8 character*/
+#define WIDE_CONTINUATION 0                                /*!<Codepoint stored in the second cell of the characters that occupy two columns*/
+#define ASCII_LIMIT 0x80                                   /*!<First codepoint that takes more than one byte in UTF-8*/
+#define N_SPECIAL_CHARS 12                                 /*!<Number of special characters that are replaced before being written in the screen*/
+#define CELL_CHANGED(s, i) ((s)->glyphs[i] != (s)->last_glyphs[i] || (s)->attrs[i] != (s)->last_attrs[i]) /*!<Macro function that checks if a cell of the screen s differs from the last painted frame*/
+
+/**
+ * @brief Attributes of the cells of the screen, each of them is painted with a different SGR sequence
+ */
+typedef enum
+{
+  NO_ATTRIBUTE = -1, /*!<No attributes are active in the terminal*/
+  ATTR_BORDER,       /*!<Cells of the background, painted with the frame color*/
+  ATTR_TEXT,         /*!<Cells of the areas, painted with the theme that corresponds to the lights*/
+  N_ATTRIBUTES       /*!<Number of attributes*/
+} Attribute;
+
+/**
+ * @brief structure that saves all of the information of a screen, so several of them can be used at the same time
+ *
+ */
+struct _Screen
+{
+  int rows;                           /*!<Number of total rows in the screen*/
+  int columns;                        /*!<Number of total columns in the screen*/
+  long *glyphs;                       /*!<Glyph plane of the screen, it stores the Unicode codepoint shown in each cell*/
+  unsigned char *attrs;               /*!<Attribute plane of the screen, it stores the Attribute of each cell*/
+  long *blank_row;                    /*!<Row of FG_CHAR codepoints copied to clear the lines of the areas*/
+  long *last_glyphs;                  /*!<Copy of the glyph plane as it was last sent to the terminal, used to repaint only the cells that changed*/
+  unsigned char *last_attrs;          /*!<Copy of the attribute plane as it was last sent to the terminal*/
+  Frame_color last_color;             /*!<Frame color used in the last painted frame*/
+  Bool last_lights_on;                /*!<Light state used in the last painted frame*/
+  char *frame;                        /*!<Output buffer where a whole frame is assembled before being written to the terminal, it is reused between frames*/
+  size_t frame_len;                   /*!<Number of bytes currently stored in the frame buffer*/
+  size_t frame_cap;                   /*!<Number of bytes allocated for the frame buffer*/
+  int frame_attr;                     /*!<Attribute currently active in the frame being assembled*/
+  const char *themes[N_ATTRIBUTES];   /*!<SGR sequence used for each attribute in the frame being assembled*/
+};
+
 /**
  * @brief structure that saves all of the information related to the area
  *
  */
 struct _Area
 {
-  int x;        /*!<X position of the area in the screen*/
-  int y;        /*!<Y position of the area in the screen*/
-  int width;    /*!<Width of the area in the screen*/
-  int height;   /*!<Height of the area in the screen*/
-  char *cursor; /*!<Pointer to where the area information starts*/
+  Screen *screen; /*!<Screen the area belongs to*/
+  int x;          /*!<X position of the area in the screen*/
+  int y;          /*!<Y position of the area in the screen*/
+  int width;      /*!<Width of the area in the screen*/
+  int height;     /*!<Height of the area in the screen*/
+  int cursor;     /*!<Index of the cell where the next line of the area starts*/
 };
 
-/*!<Global variable that stores all of the Area information*/
-char *__data;
-
 /****************************/
 /*     Private functions    */
 /****************************/
 int screen_area_cursor_is_out_of_bounds(Area *area);
 void screen_area_scroll_up(Area *area);
+void screen_area_fill(Area *area, int start, int n_rows);
 void screen_utils_replaces_special_chars(char *str);
 char *frame_color_to_string(Frame_color color);
+int screen_frame_reserve(Screen *screen, size_t n);
+void screen_frame_append(Screen *screen, const char *str, size_t len);
+void screen_frame_puts(Screen *screen, const char *str);
+void screen_frame_putc(Screen *screen, char c);
+void screen_frame_flush(Screen *screen);
+void screen_frame_reset_attr(Screen *screen);
+void screen_frame_move_cursor(Screen *screen, int row, int column);
+void screen_paint_span(Screen *screen, int start, int end);
+void screen_paint_row_changes(Screen *screen, int row);
+int screen_cells_unchanged(Screen *screen, int start, int n);
 
 /****************************/
 /* Functions implementation */
 /****************************/
-void screen_init(int rows, int columns)
+Screen *screen_init(int rows, int columns)
 {
-  screen_destroy(); /* Dispose if previously initialized */
-  ROWS = rows;
-  COLUMNS = columns;
-  __data = (char *)malloc(sizeof(char) * TOTAL_DATA);
+  Screen *screen = NULL;
+  int i;
+
+  if (rows <= 0 || columns <= 0)
+    return NULL;
+
+  if (!(screen = (Screen *)calloc(1, sizeof(Screen))))
+    return NULL;
+
+  screen->rows = rows;
+  screen->columns = columns;
+  screen->last_color = BLACK;
+  screen->last_lights_on = FALSE;
+  screen->frame_attr = NO_ATTRIBUTE;
+  screen->glyphs = (long *)malloc(sizeof(long) * TOTAL_DATA(screen));
+  screen->attrs = (unsigned char *)malloc(sizeof(unsigned char) * TOTAL_DATA(screen));
+  screen->blank_row = (long *)malloc(sizeof(long) * columns);
 
-  if (__data)
+  if (!screen->glyphs || !screen->attrs || !screen->blank_row)
   {
-    /*The memset function is used to fill memory (__data in this case) with a determined value (BG_CHAR)*/
-    memset(__data, (int)BG_CHAR, TOTAL_DATA); /*Fill the background*/
-    *(__data + TOTAL_DATA - 1) = '\0';        /*NULL-terminated string*/
+    screen_destroy(screen);
+    return NULL;
   }
+
+  /*Every cell starts as part of the background, the areas are filled when they are created*/
+  for (i = 0; i < TOTAL_DATA(screen); i++)
+    screen->glyphs[i] = BG_CHAR;
+  memset(screen->attrs, ATTR_BORDER, TOTAL_DATA(screen));
+
+  for (i = 0; i < columns; i++)
+    screen->blank_row[i] = FG_CHAR;
+
+  return screen;
 }
 
-void screen_destroy()
+void screen_destroy(Screen *screen)
 {
-  if (__data)
-    free(__data);
+  if (!screen)
+    return;
+
+  free(screen->glyphs);
+  free(screen->attrs);
+  free(screen->blank_row);
+  free(screen->last_glyphs);
+  free(screen->last_attrs);
+  free(screen->frame);
+  free(screen);
 }
 
-void screen_paint(Frame_color color, Bool lights_on)
+void screen_paint(Screen *screen, Frame_color color, Bool lights_on)
 {
-  char *src = NULL;
-  char *destination = NULL;
-  unsigned char aux[SIZE_IN_CHAR_TWO_HEXADECIMAL_VALUES + FINAL_CHARACTER]; /*Auxiliary variable where we store the two hexadecimal values that define each escape sequence*/
-  unsigned char gdesc[SIZE_OF_CONVERTED_UNCODE_SEQ + FINAL_CHARACTER];      /*Variable where we store the hexadecimal values which correspond to the UNICODE character, with the '\0' at the end*/
-  unsigned char sequence[GDESCTAM];                                         /*VAriable where we store the UNICODE sequence*/
-  int i = 0, j = 0;
-  int size_of_escape_seq_start;
-  int n_unicode_characters = 0;
-  int n_separator_lines = 0;
-  char light_theme_code[] = "[0;30;47m", dark_theme_code[] = "[0;37;40m", *selected_theme = NULL;
-
-  destination = malloc((COLUMNS + FINAL_CHARACTER) * sizeof(char));
-  if (!destination)
-  {
-    fprintf(stderr, "Memory allocation failed\n");
+  int row = 0;
+  Bool full_repaint = FALSE;
+
+  if (!screen)
     return;
-  }
 
-  size_of_escape_seq_start = strlen(START_ESCAPE_SEQUENCE);
   if (lights_on == TRUE)
   {
-    selected_theme = light_theme_code;
+    screen->themes[ATTR_TEXT] = LIGHT_THEME_CODE;
   }
   else
   {
-    selected_theme = dark_theme_code;
+    screen->themes[ATTR_TEXT] = DARK_THEME_CODE;
   }
+  screen->themes[ATTR_BORDER] = frame_color_to_string(color);
 
-  memset(destination, 0, COLUMNS + 1);
+  /*The whole screen is repainted the first time and whenever the colors change, otherwise only the cells that changed are sent*/
+  if (!screen->last_glyphs || !screen->last_attrs)
+  {
+    if (!screen->last_glyphs)
+      screen->last_glyphs = (long *)malloc(sizeof(long) * TOTAL_DATA(screen));
+    if (!screen->last_attrs)
+      screen->last_attrs = (unsigned char *)malloc(sizeof(unsigned char) * TOTAL_DATA(screen));
+    if (!screen->last_glyphs || !screen->last_attrs)
+    {
+      fprintf(stderr, "Memory allocation failed\n");
+      return;
+    }
+    full_repaint = TRUE;
+  }
+  else if (screen->last_color != color || screen->last_lights_on != lights_on)
+  {
+    full_repaint = TRUE;
+  }
 
-  if (__data)
+  screen->frame_len = 0;
+  screen->frame_attr = NO_ATTRIBUTE;
+  if (!screen_frame_reserve(screen, (size_t)TOTAL_DATA(screen) * FRAME_BYTES_PER_CELL))
+    return;
+
+  if (full_repaint == TRUE)
   {
-    /* puts(__data); */ /*Dump data directly to the terminal*/
-    /*It works fine if the terminal window has the right size*/
+    screen_frame_puts(screen, CLEAR_SCREEN); /*Clear the terminal*/
+    for (row = 0; row < screen->rows; row++)
+    {
+      screen_paint_span(screen, ACCESS(screen, 0, row), ACCESS(screen, screen->columns, row));
+      /*Attributes are reset before the line break so the background does not bleed into the next line*/
+      screen_frame_reset_attr(screen);
+      screen_frame_putc(screen, '\n');
+    }
+  }
+  else
+  {
+    for (row = 0; row < screen->rows; row++)
+    {
+      /*Rows that are the same as in the last frame are already on the terminal*/
+      if (!screen_cells_unchanged(screen, ACCESS(screen, 0, row), screen->columns))
+        screen_paint_row_changes(screen, row);
+    }
+    /*The cursor is left below the screen, clearing whatever was written there after the last frame*/
+    screen_frame_reset_attr(screen);
+    screen_frame_move_cursor(screen, screen->rows, STARTING_POSITION);
+  }
+  screen_frame_puts(screen, CLEAR_TO_END);
 
-    puts("\033[2J"); /*Clear the terminal*/
-    /*We go through the __data variable with pointer arythmetic, adding the number of columns in each iteration*/
-    for (src = __data; src < (__data + TOTAL_DATA - FINAL_CHARACTER); src += COLUMNS)
+  /*The whole frame is sent to the terminal at once*/
+  screen_frame_flush(screen);
+
+  memcpy(screen->last_glyphs, screen->glyphs, sizeof(long) * TOTAL_DATA(screen));
+  memcpy(screen->last_attrs, screen->attrs, TOTAL_DATA(screen));
+  screen->last_color = color;
+  screen->last_lights_on = lights_on;
+}
+
+/*Adds to the frame the spans of a row that changed since the last frame, each of them preceded by the sequence that moves the cursor to its start*/
+void screen_paint_row_changes(Screen *screen, int row)
+{
+  int base = ACCESS(screen, 0, row);
+  int column = 0, start = 0, end = 0, gap = 0;
+
+  while (column < screen->columns)
+  {
+    /*Blocks of unchanged cells are skipped at once*/
+    if (column + MAX_SPAN_GAP <= screen->columns && screen_cells_unchanged(screen, base + column, MAX_SPAN_GAP))
+    {
+      column += MAX_SPAN_GAP;
+      continue;
+    }
+    if (!CELL_CHANGED(screen, base + column))
     {
-      memcpy(destination, src, COLUMNS);
+      column++;
+      continue;
+    }
 
-      /*We set the number of UNICODE characters printed in the line to 0*/
-      n_unicode_characters = 0;
-      n_separator_lines = 0;
-      /*We print each character in the column individually*/
-      for (i = 0; i < COLUMNS; i++)
+    /*The span grows while the unchanged cells between two changes are fewer than the bytes needed to move the cursor*/
+    start = column;
+    end = column + NEXT_POSITION;
+    for (gap = 0, column = end; column < screen->columns && gap <= MAX_SPAN_GAP; column++)
+    {
+      if (CELL_CHANGED(screen, base + column))
+      {
+        end = column + NEXT_POSITION;
+        gap = 0;
+      }
+      else
       {
-        if (destination[i] == BG_CHAR)
-        {
-          if (n_separator_lines == SEPARATOR_LINE_AFTER_MAP)
-          {
-            /*We compensate the fact that the UNICODE character occupies 16 bytes but only one space in the printed output by printing spaces*/
-            for (j = 0; j < n_unicode_characters * (GDESCTAM - FINAL_CHARACTER - EMOTICON_SIZE); j++)
-            {
-              printf("\033%s \033[0m", selected_theme);
-            }
-          }
-          printf("%s%c\033[0m", frame_color_to_string(color), destination[i]); /* fg:blue(34);bg:blue(44) */
-          n_separator_lines++;
-        }
-        else
-        {
-          /*In case we detect an escape sequence indicating the presence of a UNICODE character, we must print this in a particular manner to ensure the terminal prints the image associated to the UNICODE sequence correctly*/
-          if (destination[i] == '\\' && destination[i + NEXT_POSITION] == 'x')
-          {
-            /*We copy the sequence to an auxiliary variable called sequence*/
-            strncpy((char *)sequence, destination + i, GDESCTAM - FINAL_CHARACTER);
-            sequence[GDESCTAM] = '\0';
-            /*For each of the escape sequences, we store the two hexadecimal values (for instance, F and 0) in aux and use strtol to convert that into one of the hexadecimal values stored in gdesc.*/
-            for (j = 0; j < N_ESCAPE_SEQ; j++)
-            {
-              aux[STARTING_POSITION] = (unsigned char)sequence[size_of_escape_seq_start + N_ESCAPE_SEQ * j];
-              aux[STARTING_POSITION + NEXT_POSITION] = (unsigned char)sequence[size_of_escape_seq_start + NEXT_POSITION + N_ESCAPE_SEQ * j];
-              aux[STARTING_POSITION + NEXT_POSITION + NEXT_POSITION] = '\0';
-              gdesc[j] = (unsigned char)strtol((char *)aux, NULL, HEXADECIMAL_BASE);
-            }
-            gdesc[SIZE_OF_CONVERTED_UNCODE_SEQ] = '\0';
-            printf("\033%s%s\033[0m", selected_theme, gdesc);
-            i += GDESCTAM - EMOTICON_SIZE;
-            n_unicode_characters++;
-          }
-          else
-          {
-            printf("\033%s%c\033[0m", selected_theme, destination[i]); /* fg white(37);bg:black(40)*/
-          }
-        }
+        gap++;
       }
-      printf("\n");
     }
+
+    /*Wide characters are always painted whole*/
+    if (start > 0 && screen->glyphs[base + start] == WIDE_CONTINUATION)
+      start--;
+    if (end < screen->columns && screen->glyphs[base + end] == WIDE_CONTINUATION)
+      end++;
+
+    screen_frame_move_cursor(screen, row, start);
+    screen_paint_span(screen, base + start, base + end);
+    column = end;
   }
-  free(destination);
-  return;
+}
+
+/*Checks if the n cells starting from start are the same as in the last frame*/
+int screen_cells_unchanged(Screen *screen, int start, int n)
+{
+  return !memcmp(screen->glyphs + start, screen->last_glyphs + start, sizeof(long) * n) && !memcmp(screen->attrs + start, screen->last_attrs + start, n);
+}
+
+/*Adds to the frame the cells from start to end (not included), only emitting the SGR sequences when the attribute changes*/
+void screen_paint_span(Screen *screen, int start, int end)
+{
+  char bytes[GLYPH_MAX_BYTES];
+  long codepoint;
+  int i;
+
+  for (i = start; i < end; i++)
+  {
+    codepoint = screen->glyphs[i];
+    /*The terminal has already advanced two columns when it printed the first cell of a wide character*/
+    if (codepoint == WIDE_CONTINUATION)
+      continue;
+
+    if (screen->attrs[i] != screen->frame_attr)
+    {
+      screen_frame_puts(screen, screen->themes[screen->attrs[i]]);
+      screen->frame_attr = screen->attrs[i];
+    }
+
+    if (codepoint < ASCII_LIMIT)
+      screen_frame_putc(screen, (char)codepoint);
+    else
+      screen_frame_append(screen, bytes, glyph_utf8_encode(codepoint, bytes));
+  }
+}
+
+/*Makes sure the frame buffer has room for n more bytes, growing it geometrically if needed*/
+int screen_frame_reserve(Screen *screen, size_t n)
+{
+  size_t new_cap = 0;
+  char *aux = NULL;
+
+  if (screen->frame_len + n <= screen->frame_cap)
+    return 1;
+
+  new_cap = screen->frame_cap ? screen->frame_cap : (size_t)TOTAL_DATA(screen);
+  while (new_cap < screen->frame_len + n)
+    new_cap *= 2;
+
+  if (!(aux = (char *)realloc(screen->frame, new_cap)))
+  {
+    fprintf(stderr, "Memory allocation failed\n");
+    return 0;
+  }
+  screen->frame = aux;
+  screen->frame_cap = new_cap;
+  return 1;
+}
+
+/*Appends len bytes of str at the end of the frame buffer*/
+void screen_frame_append(Screen *screen, const char *str, size_t len)
+{
+  if (!str || !screen_frame_reserve(screen, len))
+    return;
+  memcpy(screen->frame + screen->frame_len, str, len);
+  screen->frame_len += len;
+}
+
+/*Appends a NULL-terminated string at the end of the frame buffer*/
+void screen_frame_puts(Screen *screen, const char *str)
+{
+  if (str)
+    screen_frame_append(screen, str, strlen(str));
+}
+
+/*Appends a single character at the end of the frame buffer*/
+void screen_frame_putc(Screen *screen, char c)
+{
+  if (screen->frame_len < screen->frame_cap || screen_frame_reserve(screen, 1))
+    screen->frame[screen->frame_len++] = c;
+}
+
+/*Resets the attributes of the terminal if any are active*/
+void screen_frame_reset_attr(Screen *screen)
+{
+  if (screen->frame_attr == NO_ATTRIBUTE)
+    return;
+  screen_frame_puts(screen, RESET_ATTRIBUTES);
+  screen->frame_attr = NO_ATTRIBUTE;
+}
+
+/*Adds to the frame the sequence that places the cursor in the given row and column (starting from 0)*/
+void screen_frame_move_cursor(Screen *screen, int row, int column)
+{
+  char seq[MAX_CURSOR_SEQ];
+
+  sprintf(seq, "\033[%d;%dH", row + NEXT_POSITION, column + NEXT_POSITION);
+  screen_frame_puts(screen, seq);
+}
+
+/*Writes the whole frame buffer to the standard output with the write system call*/
+void screen_frame_flush(Screen *screen)
+{
+  size_t written = 0;
+  ssize_t n = 0;
+
+  /*Anything previously printed with stdio must reach the terminal before the frame*/
+  fflush(stdout);
+
+  while (written < screen->frame_len)
+  {
+    n = write(STDOUT_FILENO, screen->frame + written, screen->frame_len - written);
+    if (n < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return;
+    }
+    written += (size_t)n;
+  }
+  screen->frame_len = 0;
 }
 
 char *frame_color_to_string(Frame_color color)
@@ -203,18 +427,21 @@ char *frame_color_to_string(Frame_color color)
   }
 }
 
-Area *screen_area_init(int x, int y, int width, int height)
+Area *screen_area_init(Screen *screen, int x, int y, int width, int height)
 {
-  int i = 0;
   Area *area = NULL;
-  /*We assign all of the values given as arguments simultaneously, placing the cursor in the x,y position with respects to the __data pointer*/
+
+  /*The area must fit inside the screen it belongs to*/
+  if (!screen || x < 0 || y < 0 || width < 0 || height < 0 || x + width > screen->columns || y + height > screen->rows)
+    return NULL;
+
+  /*We assign all of the values given as arguments simultaneously, placing the cursor in the x,y position of the screen*/
   if ((area = (Area *)malloc(sizeof(struct _Area))))
   {
-    *area = (struct _Area){x, y, width, height, ACCESS(__data, x, y)};
+    *area = (struct _Area){screen, x, y, width, height, ACCESS(screen, x, y)};
 
     /*We fill each row with the FG_CHAR character*/
-    for (i = 0; i < area->height; i++)
-      memset(ACCESS(area->cursor, 0, i), (int)FG_CHAR, (size_t)area->width);
+    screen_area_fill(area, area->cursor, area->height);
   }
 
   return area;
@@ -228,64 +455,114 @@ void screen_area_destroy(Area *area)
 
 void screen_area_clear(Area *area)
 {
-  int i = 0;
-
   if (area)
   {
     screen_area_reset_cursor(area);
-
-    for (i = 0; i < area->height; i++)
-      memset(ACCESS(area->cursor, 0, i), (int)FG_CHAR, (size_t)area->width);
+    screen_area_fill(area, area->cursor, area->height);
   }
 }
 /*Places the cursor of an area in the starting position of said area*/
 void screen_area_reset_cursor(Area *area)
 {
   if (area)
-    area->cursor = ACCESS(__data, area->x, area->y);
+    area->cursor = ACCESS(area->screen, area->x, area->y);
 }
 
 void screen_area_puts(Area *area, char *str)
 {
-  int len = 0;
+  int len = 0, width = 0, column = 0;
+  long codepoint = 0, *cells = NULL;
   char *ptr = NULL;
 
-  if (screen_area_cursor_is_out_of_bounds(area))
-    screen_area_scroll_up(area);
+  if (!area || !str)
+    return;
 
   screen_utils_replaces_special_chars(str);
 
-  for (ptr = str; ptr < (str + strlen(str)); ptr += area->width)
+  /*Each line of the area is filled with the characters of the string that fit in its width, the rest go to the following lines*/
+  for (ptr = str; *ptr != '\0' || ptr == str; area->cursor += area->screen->columns)
   {
-    memset(area->cursor, FG_CHAR, area->width);
-    len = (strlen(ptr) < area->width) ? strlen(ptr) : area->width;
-    memcpy(area->cursor, ptr, len);
-    area->cursor += COLUMNS;
+    if (screen_area_cursor_is_out_of_bounds(area))
+      screen_area_scroll_up(area);
+    if (*ptr == '\0')
+      return;
+
+    cells = area->screen->glyphs + area->cursor;
+    memset(area->screen->attrs + area->cursor, ATTR_TEXT, area->width);
+    for (column = 0; *ptr != '\0' && column < area->width;)
+    {
+      /*Most of the characters are ASCII, so they are stored without decoding them*/
+      if ((unsigned char)*ptr < ASCII_LIMIT)
+      {
+        cells[column++] = *ptr++;
+        continue;
+      }
+
+      if ((codepoint = glyph_utf8_decode(ptr, &len)) == -1)
+        codepoint = INVALID_CHAR;
+      width = glyph_codepoint_width(codepoint);
+      if (column + width > area->width)
+      {
+        /*A character wider than the area is skipped so the line is not left empty forever*/
+        if (column == 0)
+          ptr += len;
+        break;
+      }
+      cells[column] = codepoint;
+      if (width > NEXT_POSITION)
+        cells[column + NEXT_POSITION] = WIDE_CONTINUATION;
+      ptr += len;
+      column += width;
+    }
+
+    /*The rest of the line is cleared*/
+    memcpy(cells + column, area->screen->blank_row, sizeof(long) * (area->width - column));
+  }
+}
+
+/*Fills n_rows lines of an area with the FG_CHAR character, starting from the cell start*/
+void screen_area_fill(Area *area, int start, int n_rows)
+{
+  int i = 0;
+
+  for (i = 0; i < n_rows; i++, start += area->screen->columns)
+  {
+    memcpy(area->screen->glyphs + start, area->screen->blank_row, sizeof(long) * area->width);
+    memset(area->screen->attrs + start, ATTR_TEXT, area->width);
   }
 }
 /*Checks if the cursor has exceded the size of the area*/
 int screen_area_cursor_is_out_of_bounds(Area *area)
 {
-  return area->cursor > ACCESS(__data,
+  return area->cursor > ACCESS(area->screen,
                                area->x + area->width,
                                area->y + area->height - 1);
 }
 /*Copies each line to the one before it*/
 void screen_area_scroll_up(Area *area)
 {
-  for (area->cursor = ACCESS(__data, area->x, area->y);
-       area->cursor < ACCESS(__data, area->x + area->width, area->y + area->height - 2);
-       area->cursor += COLUMNS)
+  Screen *screen = area->screen;
+
+  for (area->cursor = ACCESS(screen, area->x, area->y);
+       area->cursor < ACCESS(screen, area->x + area->width, area->y + area->height - 2);
+       area->cursor += screen->columns)
   {
-    memcpy(area->cursor, area->cursor + COLUMNS, area->width);
+    memcpy(screen->glyphs + area->cursor, screen->glyphs + area->cursor + screen->columns, sizeof(long) * area->width);
+    memcpy(screen->attrs + area->cursor, screen->attrs + area->cursor + screen->columns, area->width);
   }
 }
 
 void screen_utils_replaces_special_chars(char *str)
 {
+  char *special_chars[N_SPECIAL_CHARS] = {"Á", "É", "Í", "Ó", "Ú", "Ñ", "á", "é", "í", "ó", "ú", "ñ"};
   char *pch = NULL;
+  int i;
 
   /* Replaces acutes and tilde with '??' */
-  while ((pch = strpbrk(str, "ÁÉÍÓÚÑáéíóúñ")))
-    memcpy(pch, "??", 2);
+  /* Whole characters are searched so the bytes of other UTF-8 characters, like the ones of the graphic descriptions, are left untouched */
+  for (i = 0; i < N_SPECIAL_CHARS; i++)
+  {
+    while ((pch = strstr(str, special_chars[i])))
+      memcpy(pch, "??", 2);
+  }
 }
@@ -8,6 +8,7 @@
  * @copyright GNU Public License
  */
 #include "link.h"
+#include "string_pool.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -21,14 +22,20 @@
 struct _Link
 {
     Id link_id;               /*!< Id of the link, it must be unique */
-    char name[WORD_SIZE + 1]; /*!< Name of the link, static */
+    String_handle name;       /*!< Handle of the name of the link in the string pool, static */
     Id origin_id;             /*!< Id of the origin space it connects */
     Id destination_id;        /*!< Id of the destination space it connects */
     Direction direction;      /*!< Direction the link points towards */
     Bool is_open;             /*!< Whether link is open/unlocked or not */
+    Arena *arena;             /*!< Arena the link is allocated from, NULL if it is allocated on its own */
 };
 
 Link *link_create(Id link_id)
+{
+    return link_create_in_arena(NULL, link_id);
+}
+
+Link *link_create_in_arena(Arena *arena, Id link_id)
 {
     Link *new_link = NULL;
 
@@ -37,12 +44,13 @@ Link *link_create(Id link_id)
         return NULL;
 
     /* memory allocation */
-    if (!(new_link = (Link *)malloc(sizeof(Link))))
+    if (!(new_link = arena ? (Link *)arena_alloc(arena, sizeof(Link)) : (Link *)malloc(sizeof(Link))))
         return NULL;
 
     /* variable initializations */
+    new_link->arena = arena;
     new_link->link_id = link_id;
-    new_link->name[0] = '\0';
+    new_link->name = EMPTY_STRING;
     new_link->destination_id = NO_ID;
     new_link->origin_id = NO_ID;
     new_link->direction = UNKNOWN_DIR;
@@ -52,9 +60,21 @@ Link *link_create(Id link_id)
     return new_link;
 }
 
+Link *link_copy_in_arena(Arena *arena, Link *l)
+{
+    Link *copy = NULL;
+
+    if (!l || !(copy = arena ? (Link *)arena_alloc(arena, sizeof(Link)) : (Link *)malloc(sizeof(Link))))
+        return NULL;
+    *copy = *l;
+    copy->arena = arena;
+    return copy;
+}
+
 void link_destroy(Link *l)
 {
-    if (l)
+    /* the memory of a link in an arena is released with the arena */
+    if (l && !l->arena)
         free(l);
 }
 
@@ -67,11 +87,14 @@ Status link_set_id(Link *link, Id id)
 }
 Status link_set_name(Link *l, char *name)
 {
+    String_handle handle;
+
     if (!l || !name)
         return ERROR;
 
-    if (!(strcpy(l->name, name)))
+    if ((handle = string_pool_intern(name)) == NO_STRING)
         return ERROR;
+    l->name = handle;
 
     return OK;
 }
@@ -133,7 +156,7 @@ const char *link_get_name(Link *l)
     if (!l)
         return NULL;
 
-    return l->name;
+    return string_pool_get(l->name);
 }
 
 Id link_get_destination_id(Link *l)
@@ -197,7 +220,7 @@ void link_print(Link *l)
     }
     else
     {
-        fprintf(stdout, "-->Link information - %s - (%p):\n", l->name, (void *)l);
+        fprintf(stdout, "-->Link information - %s - (%p):\n", string_pool_get(l->name), (void *)l);
     }
 
     fprintf(stdout, " --->Link id: %ld\n", l->link_id);                 /* print link id*/
@@ -14,7 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 36 /*!<Defines de total ammount of test functions*/
+#define MAX_TESTS 38 /*!<Defines de total ammount of test functions*/
 
 /**
  * @brief in this function all test can be executated
@@ -116,6 +116,10 @@ int main(int argc, char *argv[])
         test01_link_get_name();
     if (all || test == 36)
         test02_link_get_name();
+    if (all || test == 37)
+        test01_link_create_in_arena();
+    if (all || test == 38)
+        test01_link_copy_in_arena();
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -369,4 +373,26 @@ void test02_link_get_name()
     Link *l = link_create(1);
     PRINT_TEST_RESULT(link_get_name(l) != NULL);
     link_destroy(l);
-}
\ No newline at end of file
+}
+
+void test01_link_create_in_arena()
+{
+    Arena *arena = arena_create();
+    Link *l = link_create_in_arena(arena, 1);
+    PRINT_TEST_RESULT(l != NULL && link_get_id(l) == 1);
+    link_destroy(l);
+    arena_destroy(arena);
+}
+
+void test01_link_copy_in_arena()
+{
+    Arena *arena = arena_create();
+    Link *l = link_create(1), *copy = NULL;
+    link_set_name(l, "door");
+    link_set_is_open(l, FALSE);
+    copy = link_copy_in_arena(arena, l);
+    link_set_is_open(l, TRUE);
+    PRINT_TEST_RESULT(copy != NULL && link_get_id(copy) == 1 && strcmp(link_get_name(copy), "door") == 0 && link_get_is_open(copy) == FALSE);
+    link_destroy(l);
+    arena_destroy(arena);
+}
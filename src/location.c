@@ -0,0 +1,193 @@
+/**
+ * @brief It implements the index that keeps where each object of the game is
+ *
+ * @file location.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "location.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define INITIAL_SLOTS 64             /*!<Number of slots of a new index, it must be a power of two*/
+#define HASH_MULTIPLIER 2654435761UL /*!<Odd constant the ids are multiplied by to spread them over the slots (Knuth's multiplicative hash)*/
+
+/**
+ * @brief Place of an object
+ * @author agent
+ */
+typedef struct
+{
+  Id object;           /*!<Id of the object, NO_ID in the empty slots*/
+  Container_type type; /*!<Kind of place where the object is*/
+  Id container;        /*!<Id of the space or player*/
+} Location;
+
+/**
+ * @brief Open addressing table of the places of the objects
+ * @author agent
+ */
+struct _Location_index
+{
+  Location *slots; /*!<Slots of the table*/
+  int n_slots;     /*!<Number of slots, a power of two*/
+  int n_objects;   /*!<Number of slots in use, the table grows before half of them are*/
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the slot where an object is stored, or the empty slot where it would be stored
+ * @author agent
+ * @param slots the slots of the table
+ * @param n_slots the number of slots
+ * @param object the id of the object
+ * @return the position of the slot
+ */
+int location_index_slot(Location *slots, int n_slots, Id object);
+
+/**
+ * @brief Doubles the number of slots of an index, placing the objects again
+ * @author agent
+ * @param index the index
+ * @return Status OK or ERROR
+ */
+Status location_index_grow(Location_index *index);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Location_index *location_index_create()
+{
+  Location_index *index = NULL;
+  int i;
+
+  if (!(index = (Location_index *)malloc(sizeof(Location_index))))
+    return NULL;
+
+  if (!(index->slots = (Location *)malloc(INITIAL_SLOTS * sizeof(Location))))
+  {
+    free(index);
+    return NULL;
+  }
+  for (i = 0; i < INITIAL_SLOTS; i++)
+    index->slots[i].object = NO_ID;
+  index->n_slots = INITIAL_SLOTS;
+  index->n_objects = 0;
+
+  return index;
+}
+
+void location_index_destroy(Location_index *index)
+{
+  if (!index)
+    return;
+
+  free(index->slots);
+  free(index);
+}
+
+Status location_index_set(Location_index *index, Id object, Container_type type, Id container)
+{
+  int slot;
+
+  if (!index || object == NO_ID)
+    return ERROR;
+
+  slot = location_index_slot(index->slots, index->n_slots, object);
+  if (index->slots[slot].object == NO_ID)
+  {
+    /*The table is kept at most half full, so the searches stay short*/
+    if (2 * (index->n_objects + 1) > index->n_slots)
+    {
+      if (location_index_grow(index) == ERROR)
+        return ERROR;
+      slot = location_index_slot(index->slots, index->n_slots, object);
+    }
+    index->slots[slot].object = object;
+    index->n_objects++;
+  }
+  index->slots[slot].type = type;
+  index->slots[slot].container = type == NOWHERE ? NO_ID : container;
+
+  return OK;
+}
+
+Status location_index_remove(Location_index *index, Id object, Container_type type, Id container)
+{
+  int slot;
+
+  if (!index || object == NO_ID)
+    return ERROR;
+
+  slot = location_index_slot(index->slots, index->n_slots, object);
+  if (index->slots[slot].object != NO_ID && index->slots[slot].type == type && index->slots[slot].container == container)
+  {
+    index->slots[slot].type = NOWHERE;
+    index->slots[slot].container = NO_ID;
+  }
+
+  return OK;
+}
+
+Container_type location_index_get(Location_index *index, Id object, Id *container)
+{
+  int slot;
+
+  if (container)
+    *container = NO_ID;
+  if (!index || object == NO_ID)
+    return NOWHERE;
+
+  slot = location_index_slot(index->slots, index->n_slots, object);
+  if (index->slots[slot].object == NO_ID)
+    return NOWHERE;
+
+  if (container)
+    *container = index->slots[slot].container;
+  return index->slots[slot].type;
+}
+
+int location_index_slot(Location *slots, int n_slots, Id object)
+{
+  unsigned long slot;
+
+  slot = ((unsigned long)object * HASH_MULTIPLIER) & 0xFFFFFFFFUL;
+  slot = (slot ^ (slot >> 16)) & (n_slots - 1);
+
+  /*Linear probing, the table always has empty slots so the search stops*/
+  while (slots[slot].object != NO_ID && slots[slot].object != object)
+  {
+    slot = (slot + 1) & (n_slots - 1);
+  }
+
+  return (int)slot;
+}
+
+Status location_index_grow(Location_index *index)
+{
+  Location *slots = NULL;
+  int i, n_slots = 2 * index->n_slots;
+
+  if (!(slots = (Location *)malloc(n_slots * sizeof(Location))))
+    return ERROR;
+  for (i = 0; i < n_slots; i++)
+    slots[i].object = NO_ID;
+
+  for (i = 0; i < index->n_slots; i++)
+  {
+    if (index->slots[i].object != NO_ID)
+      slots[location_index_slot(slots, n_slots, index->slots[i].object)] = index->slots[i];
+  }
+
+  free(index->slots);
+  index->slots = slots;
+  index->n_slots = n_slots;
+  return OK;
+}
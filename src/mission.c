@@ -9,6 +9,7 @@
  *
  */
 #include "mission.h"
+#include "string_pool.h"
 
 /**
  * @brief Data structure containing all information relative to a certain mission in the game
@@ -16,21 +17,28 @@
 struct _Mission
 {
     Mission_Code code;                                    /*!<The code of the mission, this codes are defined on the enumeration in mission.h*/
-    char dialogues[MAX_DIALOGUES][MAX_MISSION_MESSAGE];   /*!<The dialogues in a mission, this will be messages 'said' by the characters in the missions*/
+    String_handle dialogues[MAX_DIALOGUES];               /*!<Handles in the string pool of the dialogues in a mission, this will be messages 'said' by the characters in the missions*/
     int n_dialogues;                                      /*!<the number of dialogues a mission has*/
     int next_dialogue_index;                              /*!<the position in the array of the next dialogue*/
-    char objectives[MAX_OBJECTIVES][MAX_MISSION_MESSAGE]; /*!<the objectives of a mission, text to be shown in order for the player to see what to do*/
+    String_handle objectives[MAX_OBJECTIVES];             /*!<handles in the string pool of the objectives of a mission, text to be shown in order for the player to see what to do*/
     int n_objectives;                                     /*!<the number of objectives a mission has*/
     int next_objective_index;                             /*!<the position in the array of the next objective text*/
     int step;                                             /*!<the current step in the mission, each mission has own steps to follow*/
+    Arena *arena;                                         /*!<the arena the mission is allocated from, NULL if it is allocated on its own*/
 };
 
 Mission *mission_create()
+{
+    return mission_create_in_arena(NULL);
+}
+
+Mission *mission_create_in_arena(Arena *arena)
 {
     Mission *new_mission = NULL;
-    new_mission = (Mission *)malloc(sizeof(Mission));
+    new_mission = arena ? (Mission *)arena_alloc(arena, sizeof(Mission)) : (Mission *)malloc(sizeof(Mission));
     if (!new_mission)
         return NULL;
+    new_mission->arena = arena;
     new_mission->code = NO_MISSION;
     new_mission->next_dialogue_index = 0;
     new_mission->next_objective_index = 0;
@@ -41,11 +49,24 @@ Mission *mission_create()
     return new_mission;
 }
 
+Mission *mission_copy_in_arena(Arena *arena, Mission *mission)
+{
+    Mission *copy = NULL;
+
+    if (!mission || !(copy = arena ? (Mission *)arena_alloc(arena, sizeof(Mission)) : (Mission *)malloc(sizeof(Mission))))
+        return NULL;
+    *copy = *mission;
+    copy->arena = arena;
+    return copy;
+}
+
 Status mission_destroy(Mission *mission)
 {
     if (!mission)
         return ERROR;
-    free(mission);
+    /*the memory of a mission in an arena is released with the arena*/
+    if (!mission->arena)
+        free(mission);
     return OK;
 }
 
@@ -80,20 +101,24 @@ int mission_get_n_objectives(Mission *mission)
 
 Status mission_add_dialogue(Mission *mission, char *dialogue)
 {
-    if (!mission || !dialogue || mission->n_dialogues >= MAX_DIALOGUES)
+    String_handle handle;
+
+    if (!mission || !dialogue || mission->n_dialogues >= MAX_DIALOGUES || (handle = string_pool_intern(dialogue)) == NO_STRING)
         return ERROR;
 
-    strcpy(mission->dialogues[mission->n_dialogues], dialogue);
+    mission->dialogues[mission->n_dialogues] = handle;
     mission->n_dialogues++;
     return OK;
 }
 
 Status mission_add_objective(Mission *mission, char *objective)
 {
-    if (!mission || !objective || mission->n_objectives >= MAX_OBJECTIVES)
+    String_handle handle;
+
+    if (!mission || !objective || mission->n_objectives >= MAX_OBJECTIVES || (handle = string_pool_intern(objective)) == NO_STRING)
         return ERROR;
 
-    strcpy(mission->objectives[mission->n_objectives], objective);
+    mission->objectives[mission->n_objectives] = handle;
     mission->n_objectives++;
     return OK;
 }
@@ -103,7 +128,7 @@ char *mission_get_next_dialogue(Mission *mission)
     if (!mission || mission->next_dialogue_index >= mission->n_dialogues)
         return NULL;
     mission->next_dialogue_index++;
-    return mission->dialogues[mission->next_dialogue_index - 1];
+    return (char *)string_pool_get(mission->dialogues[mission->next_dialogue_index - 1]);
 }
 
 char *mission_get_next_objective(Mission *mission)
@@ -111,7 +136,7 @@ char *mission_get_next_objective(Mission *mission)
     if (!mission || mission->next_objective_index >= mission->n_objectives)
         return NULL;
     mission->next_objective_index++;
-    return mission->objectives[mission->next_objective_index - 1];
+    return (char *)string_pool_get(mission->objectives[mission->next_objective_index - 1]);
 }
 
 int mission_get_current_step(Mission *mission)
@@ -156,20 +181,20 @@ int mission_get_next_objective_index(Mission *mission)
 {
     if (!mission)
         return ERROR;
-    return mission->next_dialogue_index;
+    return mission->next_objective_index;
 }
 
 char *mission_get_objective_in_pos(Mission *mission, int pos)
 {
     if (!mission || pos < 0 || pos >= mission->n_objectives)
         return NULL;
-    return mission->objectives[pos];
+    return (char *)string_pool_get(mission->objectives[pos]);
 }
 char *mission_get_dialogue_in_pos(Mission *mission, int pos)
 {
     if (!mission || pos < 0 || pos >= mission->n_dialogues)
         return NULL;
-    return mission->dialogues[pos];
+    return (char *)string_pool_get(mission->dialogues[pos]);
 }
 
 char *mission_get_name(Mission_Code code)
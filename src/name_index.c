@@ -0,0 +1,242 @@
+/**
+ * @brief It implements the index that finds the entities of the game by their names
+ *
+ * @file name_index.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "name_index.h"
+#include "hash.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define INITIAL_SLOTS 64        /*!<Number of slots of a new index, it must be a power of two*/
+
+/**
+ * @brief Name of an entity
+ * @author agent
+ */
+typedef struct
+{
+  char *key;    /*!<Name of the entity in lower case, NULL in the empty slots*/
+  void *entity; /*!<Pointer to the entity*/
+} Name;
+
+/**
+ * @brief Open addressing table of the names of the entities
+ * @author agent
+ */
+struct _Name_index
+{
+  Name *slots; /*!<Slots of the table*/
+  int n_slots; /*!<Number of slots, a power of two*/
+  int n_names; /*!<Number of slots in use, the table grows before half of them are*/
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the slot where a name should be placed if there were no collisions
+ * @author agent
+ *
+ * The hash is computed over the name in lower case, so the names that only differ in the case share it.
+ * @param name the name
+ * @param n_slots the number of slots
+ * @return the position of the slot
+ */
+int name_index_home(const char *name, int n_slots);
+
+/**
+ * @brief Gets the slot where a name is stored, or the empty slot where it would be stored
+ * @author agent
+ * @param slots the slots of the table
+ * @param n_slots the number of slots
+ * @param name the name
+ * @return the position of the slot
+ */
+int name_index_slot(Name *slots, int n_slots, const char *name);
+
+/**
+ * @brief Doubles the number of slots of an index, placing the names again
+ * @author agent
+ * @param index the index
+ * @return Status OK or ERROR
+ */
+Status name_index_grow(Name_index *index);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Name_index *name_index_create()
+{
+  Name_index *index = NULL;
+  int i;
+
+  if (!(index = (Name_index *)malloc(sizeof(Name_index))))
+    return NULL;
+
+  if (!(index->slots = (Name *)malloc(INITIAL_SLOTS * sizeof(Name))))
+  {
+    free(index);
+    return NULL;
+  }
+  for (i = 0; i < INITIAL_SLOTS; i++)
+    index->slots[i].key = NULL;
+  index->n_slots = INITIAL_SLOTS;
+  index->n_names = 0;
+
+  return index;
+}
+
+void name_index_destroy(Name_index *index)
+{
+  int i;
+
+  if (!index)
+    return;
+
+  for (i = 0; i < index->n_slots; i++)
+    free(index->slots[i].key);
+  free(index->slots);
+  free(index);
+}
+
+Status name_index_add(Name_index *index, const char *name, void *entity)
+{
+  int slot, i;
+  char *key = NULL;
+
+  if (!index || !name || !entity)
+    return ERROR;
+
+  slot = name_index_slot(index->slots, index->n_slots, name);
+  if (index->slots[slot].key)
+    return OK;
+
+  /*The table is kept at most half full, so the searches stay short*/
+  if (2 * (index->n_names + 1) > index->n_slots)
+  {
+    if (name_index_grow(index) == ERROR)
+      return ERROR;
+    slot = name_index_slot(index->slots, index->n_slots, name);
+  }
+
+  if (!(key = (char *)malloc(strlen(name) + 1)))
+    return ERROR;
+  for (i = 0; name[i] != '\0'; i++)
+    key[i] = (char)tolower((unsigned char)name[i]);
+  key[i] = '\0';
+
+  index->slots[slot].key = key;
+  index->slots[slot].entity = entity;
+  index->n_names++;
+
+  return OK;
+}
+
+Status name_index_remove(Name_index *index, const char *name, void *entity)
+{
+  int slot, next, home;
+
+  if (!index || !name)
+    return ERROR;
+
+  slot = name_index_slot(index->slots, index->n_slots, name);
+  if (!index->slots[slot].key || index->slots[slot].entity != entity)
+    return OK;
+
+  free(index->slots[slot].key);
+  index->slots[slot].key = NULL;
+  index->n_names--;
+
+  /*The names that follow in the same run are moved back to the hole when their search would otherwise stop there*/
+  next = (slot + 1) & (index->n_slots - 1);
+  while (index->slots[next].key)
+  {
+    home = name_index_home(index->slots[next].key, index->n_slots);
+    if ((next > slot && (home <= slot || home > next)) || (next < slot && home <= slot && home > next))
+    {
+      index->slots[slot] = index->slots[next];
+      index->slots[next].key = NULL;
+      slot = next;
+    }
+    next = (next + 1) & (index->n_slots - 1);
+  }
+
+  return OK;
+}
+
+void *name_index_find(Name_index *index, const char *name)
+{
+  int slot;
+
+  if (!index || !name)
+    return NULL;
+
+  slot = name_index_slot(index->slots, index->n_slots, name);
+  if (!index->slots[slot].key)
+    return NULL;
+
+  return index->slots[slot].entity;
+}
+
+int name_index_home(const char *name, int n_slots)
+{
+  unsigned long hash = HASH_START;
+  char c;
+
+  /*The names are hashed in lower case, as they are compared without case*/
+  for (; *name != '\0'; name++)
+  {
+    c = (char)tolower((unsigned char)*name);
+    hash = hash_bytes(hash, &c, 1);
+  }
+
+  return (int)(hash & (n_slots - 1));
+}
+
+int name_index_slot(Name *slots, int n_slots, const char *name)
+{
+  int slot;
+
+  slot = name_index_home(name, n_slots);
+
+  /*Linear probing, the table always has empty slots so the search stops*/
+  while (slots[slot].key && strcasecmp(slots[slot].key, name) != 0)
+  {
+    slot = (slot + 1) & (n_slots - 1);
+  }
+
+  return slot;
+}
+
+Status name_index_grow(Name_index *index)
+{
+  Name *slots = NULL;
+  int i, n_slots = 2 * index->n_slots;
+
+  if (!(slots = (Name *)malloc(n_slots * sizeof(Name))))
+    return ERROR;
+  for (i = 0; i < n_slots; i++)
+    slots[i].key = NULL;
+
+  for (i = 0; i < index->n_slots; i++)
+  {
+    if (index->slots[i].key)
+      slots[name_index_slot(slots, n_slots, index->slots[i].key)] = index->slots[i];
+  }
+
+  free(index->slots);
+  index->slots = slots;
+  index->n_slots = n_slots;
+  return OK;
+}
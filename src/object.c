@@ -10,6 +10,8 @@
  *
  */
 #include "object.h"
+#include "glyph.h"
+#include "string_pool.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -23,28 +25,36 @@
 struct _Object
 {
     long id;                     /*!< Id number of the object, it must be unique*/
-    char name[WORD_SIZE];        /*!< Name of the object*/
-    char description[WORD_SIZE]; /*!< The description of the object to inspect*/
+    String_handle name;          /*!< Handle of the name of the object in the string pool*/
+    String_handle description;   /*!< Handle of the description of the object to inspect in the string pool*/
     char gdesc[GDESCTAM];        /*!< The graphical description of the object*/
     int health;                  /*!< Amount o fhealth object gan give or take from player */
     Bool movable;                /*!< Whether the object can be moved between spaces*/
     Id dependency;               /*!< Id of which object this object is dependent on to be picked up, if any */
     Id open;                     /*!< Id of the link this object can open when used, if any */
+    Arena *arena;                /*!< Arena the object is allocated from, NULL if it is allocated on its own*/
 };
 
 Object *object_create(Id id)
+{
+    return object_create_in_arena(NULL, id);
+}
+
+Object *object_create_in_arena(Arena *arena, Id id)
 {
     Object *newObject = NULL;
     /* Error control*/
     if (id == NO_ID)
         return NULL;
-    newObject = (Object *)malloc(sizeof(Object));
+    newObject = arena ? (Object *)arena_alloc(arena, sizeof(Object)) : (Object *)malloc(sizeof(Object));
     if (!newObject)
         return NULL;
     /*Initialization of an empty object*/
+    newObject->arena = arena;
     newObject->id = id;
-    newObject->name[0] = '\0';
-    newObject->description[0] = '\0';
+    newObject->name = EMPTY_STRING;
+    newObject->description = EMPTY_STRING;
+    newObject->gdesc[0] = '\0';
     newObject->movable = FALSE;
     newObject->health = NO_HP;
     newObject->open = NO_ID;
@@ -53,12 +63,25 @@ Object *object_create(Id id)
     return newObject;
 }
 
+Object *object_copy_in_arena(Arena *arena, Object *object)
+{
+    Object *copy = NULL;
+
+    if (!object || !(copy = arena ? (Object *)arena_alloc(arena, sizeof(Object)) : (Object *)malloc(sizeof(Object))))
+        return NULL;
+    *copy = *object;
+    copy->arena = arena;
+    return copy;
+}
+
 Status object_destroy(Object *object)
 {
     /*Error checking*/
     if (!object)
         return ERROR;
-    free(object);
+    /*The memory of an object in an arena is released with the arena*/
+    if (!object->arena)
+        free(object);
     return OK;
 }
 
@@ -75,7 +98,7 @@ char *object_get_name(Object *object)
     /*Error checking*/
     if (!object)
         return NULL;
-    return object->name;
+    return (char *)string_pool_get(object->name);
 }
 
 Status object_set_id(Object *object, Id id)
@@ -89,10 +112,12 @@ Status object_set_id(Object *object, Id id)
 
 Status object_set_name(Object *object, char *name)
 {
+    String_handle handle;
+
     /*Error checking*/
-    if (!object)
+    if (!object || (handle = string_pool_intern(name)) == NO_STRING)
         return ERROR;
-    strcpy(object->name, name);
+    object->name = handle;
     return OK;
 }
 
@@ -107,11 +132,11 @@ Status object_print(Object *object)
     {
         return ERROR;
     }
-    if (fprintf(stdout, "--->Object name: %s\n", object->name) < 0)
+    if (fprintf(stdout, "--->Object name: %s\n", string_pool_get(object->name)) < 0)
     {
         return ERROR;
     }
-    if (fprintf(stdout, "-->Object description: %s\n", object->description) < 0)
+    if (fprintf(stdout, "-->Object description: %s\n", string_pool_get(object->description)) < 0)
     {
         return ERROR;
     }
@@ -166,11 +191,13 @@ Status object_print(Object *object)
 
 Status object_set_description(Object *object, char *desc)
 {
-    if (!object || !desc)
+    String_handle handle;
+
+    if (!object || !desc || (handle = string_pool_intern(desc)) == NO_STRING)
     {
         return ERROR;
     }
-    strcpy(object->description, desc);
+    object->description = handle;
     return OK;
 }
 
@@ -180,7 +207,7 @@ char *object_get_description(Object *object)
     {
         return NULL;
     }
-    return object->description;
+    return (char *)string_pool_get(object->description);
 }
 
 Status object_set_health(Object *object, int health)
@@ -261,9 +288,8 @@ Status object_set_gdesc(Object *object, char *gdesc)
     {
         return ERROR;
     }
-    strncpy(object->gdesc, gdesc, GDESCTAM - 1);
-    object->gdesc[GDESCTAM - 1] = '\0';
-    return OK;
+    /*The escape sequences are decoded once here so the UTF-8 bytes can be printed directly*/
+    return glyph_decode(object->gdesc, gdesc, GDESCTAM);
 }
 
 char *object_get_gdesc(Object *object)
@@ -273,4 +299,4 @@ char *object_get_gdesc(Object *object)
         return NULL;
     }
     return object->gdesc;
-}
\ No newline at end of file
+}
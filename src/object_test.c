@@ -12,7 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 39 /*!<Defines the total ammount of test functions*/
+#define MAX_TESTS 43 /*!<Defines the total ammount of test functions*/
 
 /**
  * @brief in the main function all tests can be executated
@@ -120,6 +120,14 @@ int main(int argc, char **argv)
         test1_object_set_gdesc();
     if (all || test == 39)
         test2_object_set_gdesc();
+    if (all || test == 40)
+        test3_object_set_gdesc();
+    if (all || test == 41)
+        test1_object_create_in_arena();
+    if (all || test == 42)
+        test3_object_set_description();
+    if (all || test == 43)
+        test1_object_copy_in_arena();
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -377,3 +385,44 @@ void test2_object_get_movable()
 {
     PRINT_TEST_RESULT(object_get_movable(NULL) == NO_ID);
 }
+
+void test3_object_set_gdesc()
+{
+    Object *o = object_create(1);
+    object_set_gdesc(o, "\\xF0\\x9F\\x94\\x8B");
+    PRINT_TEST_RESULT(strcmp(object_get_gdesc(o), "\xF0\x9F\x94\x8B") == 0);
+    object_destroy(o);
+}
+
+void test1_object_create_in_arena()
+{
+    Arena *arena = arena_create();
+    Object *o = object_create_in_arena(arena, 1);
+    PRINT_TEST_RESULT(o != NULL && object_get_id(o) == 1 && object_destroy(o) == OK);
+    arena_destroy(arena);
+}
+
+void test3_object_set_description()
+{
+    Object *o1 = object_create(1), *o2 = object_create(2);
+    char desc[WORD_SIZE] = "A rusty key";
+    object_set_description(o1, desc);
+    strcpy(desc, "A new key");
+    object_set_description(o2, "A rusty key");
+    PRINT_TEST_RESULT(strcmp(object_get_description(o1), "A rusty key") == 0 && object_get_description(o1) == object_get_description(o2));
+    object_destroy(o1);
+    object_destroy(o2);
+}
+
+void test1_object_copy_in_arena()
+{
+    Arena *arena = arena_create();
+    Object *o = object_create(1), *copy = NULL;
+    object_set_name(o, "key");
+    object_set_health(o, 2);
+    copy = object_copy_in_arena(arena, o);
+    object_set_health(o, 3);
+    PRINT_TEST_RESULT(copy != NULL && object_get_id(copy) == 1 && strcmp(object_get_name(copy), "key") == 0 && object_get_health(copy) == 2);
+    object_destroy(o);
+    arena_destroy(arena);
+}
@@ -9,6 +9,8 @@
  */
 
 #include "player.h"
+#include "glyph.h"
+#include "string_pool.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -23,7 +25,7 @@
 struct _Player
 {
   Id id;                    /*!< Id number of the player, it must be unique */
-  char name[WORD_SIZE + 1]; /*!< Name of the player */
+  String_handle name;       /*!< Handle of the name of the player in the string pool */
   Id location;              /*!<Id of the   where the player is located*/
   int health;               /*!< Hp points of the player*/
   char Gdesc[GDESCTAM];     /*!< The graphic description of the player*/
@@ -48,7 +50,7 @@ Player *player_create(Id id, int inventory_size)
 
   /* Initialization of an empty player*/
   newPlayer->id = id;
-  newPlayer->name[0] = '\0';
+  newPlayer->name = EMPTY_STRING;
   newPlayer->location = NO_ID;
   newPlayer->backpack = inventory_create(inventory_size); /* Initialize backpack with BACKPACK_CAPACITY objects */
   newPlayer->health = 5;
@@ -58,6 +60,26 @@ Player *player_create(Id id, int inventory_size)
   return newPlayer;
 }
 
+/**This function copies the fields of the player at once, and the backpack apart */
+Player *player_copy(Player *player)
+{
+  Player *copy = NULL;
+
+  if (!player || !(copy = (Player *)malloc(sizeof(Player))))
+  {
+    return NULL;
+  }
+
+  *copy = *player;
+  if (!(copy->backpack = inventory_copy(player->backpack)))
+  {
+    free(copy);
+    return NULL;
+  }
+
+  return copy;
+}
+
 /** This function destroys a player and frees the allocated memory */
 Status player_destroy(Player *player)
 {
@@ -95,15 +117,18 @@ Id player_get_id(Player *player)
 /**Sets the name of the player */
 Status player_set_name(Player *player, char *name)
 {
+  String_handle handle;
+
   if (!player || !name)
   {
     return ERROR;
   }
 
-  if (!strcpy(player->name, name))
+  if ((handle = string_pool_intern(name)) == NO_STRING)
   {
     return ERROR;
   }
+  player->name = handle;
   return OK;
 }
 
@@ -114,7 +139,7 @@ const char *player_get_name(Player *player)
   {
     return NULL;
   }
-  return player->name;
+  return string_pool_get(player->name);
 }
 
 /**This function checks if the player's backpack is full */
@@ -245,7 +270,7 @@ Status player_print(Player *player)
   }
 
   /* Print the id and the name of the player */
-  fprintf(stdout, "--> Player (Id: %ld; Name: %s)\n", player->id, player->name);
+  fprintf(stdout, "--> Player (Id: %ld; Name: %s)\n", player->id, string_pool_get(player->name));
 
   /* Print the player's location */
   fprintf(stdout, "--> Id of the player's location: %ld", player->location);
@@ -288,9 +313,8 @@ Status player_set_gdesc(Player *player, char *gdesc)
     return ERROR;
   }
 
-  strcpy(player->Gdesc, gdesc);
-
-  return OK;
+  /*The escape sequences are decoded once here so the UTF-8 bytes can be printed directly*/
+  return glyph_decode(player->Gdesc, gdesc, GDESCTAM);
 }
 
 char *player_get_gdesc(Player *player)
@@ -302,6 +326,7 @@ char *player_get_gdesc(Player *player)
   return player->Gdesc;
 }
 
+
 Bool player_object_is_in_backpack(Player *player, Id objectId)
 {
   if (!player)
@@ -339,3 +364,10 @@ Status player_set_team(Player *player, Id team)
   player->team = team;
   return OK;
 }
+
+Status player_set_location_index(Player *player, Location_index *index)
+{
+  if (!player)
+    return ERROR;
+  return inventory_set_location_index(player->backpack, index, player->id);
+}
@@ -14,7 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 50 /*!<Defines the total ammount of test functions*/
+#define MAX_TESTS 52 /*!<Defines the total ammount of test functions*/
 
 /**
  * @brief Main function for PLAYER unit tests.
@@ -148,6 +148,10 @@ int main(int argc, char **argv)
         test1_player_set_team();
     if (all || test == 50)
         test2_player_set_team();
+    if (all || test == 51)
+        test1_player_set_gdesc();
+    if (all || test == 52)
+        test1_player_copy();
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -685,3 +689,26 @@ void test2_player_set_team()
         player_destroy(player);
     }
 }
+
+void test1_player_set_gdesc()
+{
+    Player *player = NULL;
+    player = player_create(1, 3);
+    player_set_gdesc(player, "\\xF0\\x9F\\x91\\xA9");
+    PRINT_TEST_RESULT(strcmp(player_get_gdesc(player), "\xF0\x9F\x91\xA9") == 0);
+    player_destroy(player);
+}
+
+void test1_player_copy()
+{
+    Player *player = player_create(1, 3), *copy = NULL;
+    player_set_name(player, "Alice");
+    player_set_location(player, 11);
+    player_add_object_to_backpack(player, 5);
+    copy = player_copy(player);
+    player_remove_object_from_backpack(player, 5);
+    player_set_location(player, 12);
+    PRINT_TEST_RESULT(copy != NULL && strcmp(player_get_name(copy), "Alice") == 0 && player_get_location(copy) == 11 && player_backpack_contains(copy, 5) == TRUE);
+    player_destroy(player);
+    player_destroy(copy);
+}
@@ -0,0 +1,198 @@
+/**
+ * @brief It implements the reader used to load the data and saved files
+ *
+ * @file reader.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "reader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define DECIMAL_BASE 10 /*!<Base of the numbers written in the files*/
+
+/**
+ * @brief Structure where the contents of the file being read are stored
+ * @author agent
+ */
+struct _Reader
+{
+  char *data;  /*!<Contents of the file, followed by at least one writable byte so the last field can be terminated*/
+  long size;   /*!<Size of the file*/
+  long pos;    /*!<Position of the next line*/
+  Bool mapped; /*!<Whether data is a memory mapping of the file or a copy made with malloc*/
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Reads the whole file into memory, when it can not be mapped
+ * @author agent
+ * @param reader the reader
+ * @param fd file descriptor of the file
+ * @return Status OK or ERROR
+ */
+Status reader_load(Reader *reader, int fd);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Reader *reader_open(char *filename)
+{
+  Reader *reader = NULL;
+  struct stat info;
+  int fd;
+
+  if (!filename)
+    return NULL;
+
+  if ((fd = open(filename, O_RDONLY)) == -1)
+    return NULL;
+
+  if (fstat(fd, &info) == -1 || !(reader = (Reader *)calloc(1, sizeof(Reader))))
+  {
+    close(fd);
+    return NULL;
+  }
+  reader->size = (long)info.st_size;
+
+  /*The mapping is private, so terminating the fields does not modify the file. If the file fills its last page
+  there is no room after it to terminate the last field, so it is read instead*/
+  if (S_ISREG(info.st_mode) && reader->size > 0 && reader->size % sysconf(_SC_PAGESIZE) != 0)
+  {
+    reader->data = (char *)mmap(NULL, reader->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (reader->data == MAP_FAILED)
+      reader->data = NULL;
+    else
+      reader->mapped = TRUE;
+  }
+
+  if (!reader->data && reader_load(reader, fd) == ERROR)
+  {
+    free(reader);
+    reader = NULL;
+  }
+
+  close(fd);
+  return reader;
+}
+
+void reader_close(Reader *reader)
+{
+  if (!reader)
+    return;
+
+  if (reader->mapped == TRUE)
+    munmap(reader->data, reader->size);
+  else
+    free(reader->data);
+  free(reader);
+}
+
+Bool reader_next_line(Reader *reader, Field *line)
+{
+  char *end = NULL;
+
+  if (!reader || !line || reader->pos >= reader->size)
+    return FALSE;
+
+  line->str = reader->data + reader->pos;
+  if ((end = (char *)memchr(line->str, '\n', reader->size - reader->pos)))
+  {
+    line->len = end - line->str;
+    reader->pos += line->len + 1;
+  }
+  else
+  {
+    line->len = reader->size - reader->pos;
+    reader->pos = reader->size;
+  }
+
+  return TRUE;
+}
+
+Bool field_next(Field *line, const char *separators, Field *field)
+{
+  if (!line || !separators || !field)
+    return FALSE;
+
+  /*Consecutive separators are skipped*/
+  while (line->len > 0 && strchr(separators, *line->str))
+  {
+    line->str++;
+    line->len--;
+  }
+  if (line->len == 0)
+    return FALSE;
+
+  field->str = line->str;
+  for (field->len = 0; field->len < line->len && !strchr(separators, field->str[field->len]); field->len++)
+    ;
+
+  /*The separator that follows the field is consumed too, so it can be overwritten by field_terminate*/
+  line->str += field->len;
+  line->len -= field->len;
+  if (line->len > 0)
+  {
+    line->str++;
+    line->len--;
+  }
+
+  return TRUE;
+}
+
+char *field_terminate(Field *field)
+{
+  if (!field || !field->str)
+    return NULL;
+
+  field->str[field->len] = '\0';
+  return field->str;
+}
+
+long field_to_long(Field field)
+{
+  long value = 0;
+  int i = 0, sign = 1;
+
+  while (i < field.len && (field.str[i] == ' ' || field.str[i] == '\t'))
+    i++;
+  if (i < field.len && (field.str[i] == '-' || field.str[i] == '+'))
+  {
+    sign = field.str[i] == '-' ? -1 : 1;
+    i++;
+  }
+  for (; i < field.len && field.str[i] >= '0' && field.str[i] <= '9'; i++)
+  {
+    value = value * DECIMAL_BASE + (field.str[i] - '0');
+  }
+
+  return sign * value;
+}
+
+Status reader_load(Reader *reader, int fd)
+{
+  long total = 0, n = 0;
+
+  if (!(reader->data = (char *)malloc(reader->size + 1)))
+    return ERROR;
+
+  while (total < reader->size && (n = read(fd, reader->data + total, reader->size - total)) > 0)
+    total += n;
+
+  reader->size = total;
+  reader->data[total] = '\0';
+  reader->mapped = FALSE;
+  return OK;
+}
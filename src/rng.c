@@ -0,0 +1,150 @@
+/**
+ * @brief It implements the generator of random numbers
+ *
+ * @file rng.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "rng.h"
+
+#include <stdlib.h>
+
+#define RNG_MASK 0xFFFFFFFFUL      /*!<The words are of 32 bits, whatever the size of unsigned long*/
+#define SEED_INCREMENT 0x9E3779B9UL /*!<Added to the seed for each word of the state (splitmix)*/
+#define SEED_MIX1 0x85EBCA6BUL      /*!<First multiplier used to mix the seed*/
+#define SEED_MIX2 0xC2B2AE35UL      /*!<Second multiplier used to mix the seed*/
+
+/**
+ * @brief Generator
+ * @author agent
+ */
+struct _Rng
+{
+  unsigned long state[RNG_STATE_SIZE]; /*!<State, four words of 32 bits that are never all 0*/
+};
+
+/*Private functions*/
+
+/**
+ * @brief Rotates a word of 32 bits to the left
+ * @author agent
+ * @param x the word
+ * @param k the number of bits, from 1 to 31
+ * @return the rotated word
+ */
+unsigned long rng_rotate(unsigned long x, int k);
+
+/*End of private functions*/
+
+Rng *rng_create(unsigned long seed)
+{
+  Rng *rng = NULL;
+
+  if (!(rng = (Rng *)malloc(sizeof(Rng))))
+    return NULL;
+  rng_seed(rng, seed);
+  return rng;
+}
+
+void rng_destroy(Rng *rng)
+{
+  free(rng);
+}
+
+Status rng_seed(Rng *rng, unsigned long seed)
+{
+  unsigned long z;
+  int i;
+
+  if (!rng)
+    return ERROR;
+
+  /*Close seeds must give unrelated states, so each word is the seed mixed*/
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+  {
+    z = (seed + SEED_INCREMENT * (unsigned long)(i + 1)) & RNG_MASK;
+    z = ((z ^ (z >> 16)) * SEED_MIX1) & RNG_MASK;
+    z = ((z ^ (z >> 13)) * SEED_MIX2) & RNG_MASK;
+    rng->state[i] = z ^ (z >> 16);
+  }
+  if (!rng->state[0] && !rng->state[1] && !rng->state[2] && !rng->state[3])
+    rng->state[0] = 1;
+  return OK;
+}
+
+unsigned long rng_next(Rng *rng)
+{
+  unsigned long *s, result, t;
+
+  if (!rng)
+    return 0;
+
+  s = rng->state;
+  result = (rng_rotate((s[1] * 5) & RNG_MASK, 7) * 9) & RNG_MASK;
+  t = (s[1] << 9) & RNG_MASK;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = rng_rotate(s[3], 11);
+  return result;
+}
+
+int rng_range(Rng *rng, int n)
+{
+  unsigned long limit, x;
+
+  if (!rng || n <= 0)
+    return 0;
+
+  /*The numbers above the last multiple of n are drawn again, otherwise the small results would be more likely*/
+  limit = RNG_MASK - (RNG_MASK % (unsigned long)n + 1) % (unsigned long)n;
+  do
+  {
+    x = rng_next(rng);
+  } while (x > limit);
+  return (int)(x % (unsigned long)n);
+}
+
+Status rng_get_state(Rng *rng, unsigned long *state)
+{
+  int i;
+
+  if (!rng || !state)
+    return ERROR;
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+    state[i] = rng->state[i];
+  return OK;
+}
+
+Status rng_set_state(Rng *rng, const unsigned long *state)
+{
+  int i;
+  Bool zero = TRUE;
+
+  if (!rng || !state)
+    return ERROR;
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+  {
+    if (state[i] > RNG_MASK)
+      return ERROR;
+    if (state[i])
+      zero = FALSE;
+  }
+  /*A state of zeros would only give zeros*/
+  if (zero == TRUE)
+    return ERROR;
+
+  for (i = 0; i < RNG_STATE_SIZE; i++)
+    rng->state[i] = state[i];
+  return OK;
+}
+
+unsigned long rng_rotate(unsigned long x, int k)
+{
+  return ((x << k) | (x >> (32 - k))) & RNG_MASK;
+}
@@ -0,0 +1,186 @@
+/**
+ * @brief It implements the saver
+ *
+ * @file saver.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "saver.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define TEMP_SUFFIX ".tmp" /*!<Added to the name of a file to get the name of the temporary file it is written to first*/
+
+/**
+ * @brief Saver
+ *
+ * The thread only reads the data and the name and writes the status, the done flag is read and written under the lock.
+ *  The previous saver is only touched by the thread, which waits for it and frees it.
+ * @author agent
+ */
+struct _Saver
+{
+  pthread_t thread;      /*!<Thread that writes the file*/
+  pthread_mutex_t lock;  /*!<Lock of the done flag*/
+  Bool done;             /*!<TRUE once the thread has finished*/
+  Status status;         /*!<Result of the write, valid once it is done*/
+  char *data;            /*!<Data to be written*/
+  long size;             /*!<Number of bytes of the data*/
+  char *filename;        /*!<Name of the file*/
+  Saver *previous;       /*!<Saver to wait for before writing, NULL if there is none*/
+};
+
+/*Private functions*/
+
+/**
+ * @brief Body of the thread of a saver, it writes the file and marks the saver as done
+ * @author agent
+ * @param arg the saver
+ * @return NULL
+ */
+void *saver_run(void *arg);
+
+/*End of private functions*/
+
+Status saver_write(char *data, long size, char *filename)
+{
+  char *temp = NULL;
+  long written = 0, n;
+  int fd;
+  Status status = OK;
+
+  if (!data || size < 0 || !filename)
+    return ERROR;
+
+  if (!(temp = (char *)malloc(strlen(filename) + strlen(TEMP_SUFFIX) + 1)))
+    return ERROR;
+  sprintf(temp, "%s%s", filename, TEMP_SUFFIX);
+
+  if ((fd = open(temp, O_WRONLY | O_CREAT | O_TRUNC, 0644)) == -1)
+  {
+    free(temp);
+    return ERROR;
+  }
+  while (written < size && status == OK)
+  {
+    n = (long)write(fd, data + written, size - written);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      status = ERROR;
+    else
+      written += n;
+  }
+  /*The data must be on disk before the rename makes it the file, otherwise a crash could leave the file empty*/
+  if (status == OK && fsync(fd) == -1)
+    status = ERROR;
+  if (close(fd) == -1)
+    status = ERROR;
+
+  if (status == OK && rename(temp, filename) != 0)
+    status = ERROR;
+  if (status == ERROR)
+    remove(temp);
+
+  free(temp);
+  return status;
+}
+
+Saver *saver_start(char *data, long size, char *filename, Saver *previous)
+{
+  Saver *saver = NULL;
+
+  if (!data || !filename || !(saver = (Saver *)calloc(1, sizeof(Saver))))
+  {
+    free(data);
+    return NULL;
+  }
+  saver->data = data;
+  saver->size = size;
+  saver->done = FALSE;
+  saver->status = ERROR;
+  saver->previous = previous;
+  if (!(saver->filename = (char *)malloc(strlen(filename) + 1)))
+  {
+    free(data);
+    free(saver);
+    return NULL;
+  }
+  strcpy(saver->filename, filename);
+
+  if (pthread_mutex_init(&saver->lock, NULL) != 0)
+  {
+    free(saver->filename);
+    free(data);
+    free(saver);
+    return NULL;
+  }
+  if (pthread_create(&saver->thread, NULL, saver_run, saver) != 0)
+  {
+    pthread_mutex_destroy(&saver->lock);
+    free(saver->filename);
+    free(data);
+    free(saver);
+    return NULL;
+  }
+  return saver;
+}
+
+Bool saver_is_done(Saver *saver)
+{
+  Bool done;
+
+  if (!saver)
+    return TRUE;
+
+  pthread_mutex_lock(&saver->lock);
+  done = saver->done;
+  pthread_mutex_unlock(&saver->lock);
+  return done;
+}
+
+Status saver_finish(Saver *saver)
+{
+  Status status;
+
+  if (!saver)
+    return ERROR;
+
+  if (pthread_join(saver->thread, NULL) != 0)
+    status = ERROR;
+  else
+    status = saver->status;
+
+  pthread_mutex_destroy(&saver->lock);
+  free(saver->filename);
+  free(saver->data);
+  free(saver);
+  return status;
+}
+
+void *saver_run(void *arg)
+{
+  Saver *saver = (Saver *)arg;
+  Status status = OK;
+
+  /*The previous file could be the same one, it must be written before, and if it failed the failure is kept*/
+  if (saver->previous)
+    status = saver_finish(saver->previous);
+  if (saver_write(saver->data, saver->size, saver->filename) == ERROR)
+    status = ERROR;
+
+  pthread_mutex_lock(&saver->lock);
+  saver->status = status;
+  saver->done = TRUE;
+  pthread_mutex_unlock(&saver->lock);
+  return NULL;
+}
@@ -10,63 +10,177 @@
 
 #include "set.h"
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#define BITMAP_BITS 256                              /*!<Number of consecutive ids the bitmap of a set covers, a multiple of the bits of a word*/
+#define WORD_BITS (CHAR_BIT * sizeof(unsigned long)) /*!<Number of bits of each word of the bitmap*/
+#define BITMAP_WORDS (BITMAP_BITS / WORD_BITS)       /*!<Number of words of the bitmap*/
+
 /**
  * @brief this structure will be used for the definition of sets accross the game
+ *
+ * The ids are kept in a contiguous array, in the order they were added. While all of them are close to each other
+ *  (dense), a bitmap of the range they are in answers whether an id belongs with a single bit test.
+ *  Once an id out of that range is added, the set becomes sparse and the array is scanned instead, until it is emptied.
  */
 struct _Set
 {
-    int n_ids;                   /*!<Number of elements in the set*/
-    Id ids[MAX_ELEMENTS_IN_SET]; /*!<Id of elements in the set*/
+    int n_ids;                          /*!<Number of elements in the set*/
+    int size;                           /*!<Number of elements the array has room for*/
+    Id *ids;                            /*!<Id of elements in the set, it points to small_ids until the set grows past MAX_ELEMENTS_IN_SET*/
+    Id small_ids[MAX_ELEMENTS_IN_SET];  /*!<Room for the elements of the small sets, so they need no other allocation*/
+    Bool dense;                         /*!<TRUE if every element is in the range of the bitmap*/
+    Id base;                            /*!<First id of the range of the bitmap*/
+    unsigned long bitmap[BITMAP_WORDS]; /*!<Bit of each id of the range, set for the elements of the set*/
+    Arena *arena;                       /*!<Arena the set and its array are allocated from, NULL if they are allocated on their own*/
 };
 
+/**
+   Private functions
+*/
+
+/**
+ * @brief Gets the position of an element in the array of a set, with a single scan
+ * @author agent
+ * @param s a pointer to the set
+ * @param elementId the id of the element
+ * @return the position of the element, or -1 if it is not in the set
+ */
+int set_find(Set *s, Id elementId);
+
+/**
+ * @brief Sets or clears the bit of an id in the bitmap of a dense set, the id must be in its range
+ * @author agent
+ * @param s a pointer to the set
+ * @param elementId the id
+ * @param value TRUE to set the bit, FALSE to clear it
+ */
+void set_mark(Set *s, Id elementId, Bool value);
+
+/*End of private functions*/
+
 /**This function allocates memory for a new Set structure and initializes its fields. */
 Set *set_create()
+{
+    return set_create_in_arena(NULL);
+}
+
+/**This function carves a new Set structure from the arena, or allocates it if there is none, and initializes its fields. */
+Set *set_create_in_arena(Arena *arena)
 {
     Set *s;
     int i;
-    if (!(s = (Set *)calloc(sizeof(Set), 1)))
+    if (!(s = arena ? (Set *)arena_alloc(arena, sizeof(Set)) : (Set *)calloc(sizeof(Set), 1)))
     {
         return NULL;
     }
     /*sets all positions in the set to NO_ID*/
     for (i = 0; i < MAX_ELEMENTS_IN_SET; i++)
     {
-        s->ids[i] = NO_ID;
+        s->small_ids[i] = NO_ID;
     }
-    /*initialize the number of elements to 0*/
+    /*initialize the number of elements to 0, the elements are kept in the small array and the bitmap is empty*/
     s->n_ids = 0;
+    s->size = MAX_ELEMENTS_IN_SET;
+    s->ids = s->small_ids;
+    s->dense = TRUE;
+    s->base = NO_ID;
+    s->arena = arena;
     return s;
 }
 
-/**This function frees the memory allocated for the Set structure */
+/**This function copies the whole structure at once, only the array of a set that has grown has to be copied apart */
+Set *set_copy_in_arena(Arena *arena, Set *s)
+{
+    Set *copy = NULL;
+    int i;
+    if (!s || !(copy = arena ? (Set *)arena_alloc(arena, sizeof(Set)) : (Set *)malloc(sizeof(Set))))
+    {
+        return NULL;
+    }
+    *copy = *s;
+    copy->arena = arena;
+    copy->ids = copy->small_ids;
+    if (s->ids != s->small_ids)
+    {
+        if (!(copy->ids = arena ? (Id *)arena_alloc(arena, s->size * sizeof(Id)) : (Id *)malloc(s->size * sizeof(Id))))
+        {
+            if (!arena)
+                free(copy);
+            return NULL;
+        }
+        for (i = 0; i < s->n_ids; i++)
+            copy->ids[i] = s->ids[i];
+    }
+    return copy;
+}
+
+/**This function frees the memory allocated for the Set structure, the sets of an arena are freed with it */
 Status set_destroy(Set *s)
 {
     if (s == NULL)
         return ERROR;
+    if (s->arena)
+        return OK;
+    if (s->ids != s->small_ids)
+        free(s->ids);
     free(s);
     return OK;
 }
 
-/**This function adds the specified element to the set if it is not already present
- * and if the set has not reached its maximum capacity */
+/**This function adds the specified element to the set if it is not already present.
+ * If the array of the set is full it is doubled */
 Status set_add(Set *s, Id elementId)
 {
+    Id *ids = NULL;
+    int i;
+
     if (!s || elementId == NO_ID)
         return ERROR;
 
-    /*ensure the set has not reached its maximum capacity*/
-    if (s->n_ids == (MAX_ELEMENTS_IN_SET))
-    {
-        return ERROR;
-    }
     /*If the element is already in the set, return OK*/
     if (set_belongs(s, elementId))
     {
         return OK;
     }
+
+    /*make room for the element, the first time the small array is copied to the heap. In an arena the array is always
+    copied to a new one, the old one is released with the arena*/
+    if (s->n_ids == s->size)
+    {
+        if (s->ids == s->small_ids || s->arena)
+        {
+            if (!(ids = s->arena ? (Id *)arena_alloc(s->arena, 2 * s->size * sizeof(Id)) : (Id *)malloc(2 * s->size * sizeof(Id))))
+                return ERROR;
+            for (i = 0; i < s->n_ids; i++)
+                ids[i] = s->ids[i];
+        }
+        else if (!(ids = (Id *)realloc(s->ids, 2 * s->size * sizeof(Id))))
+        {
+            return ERROR;
+        }
+        s->ids = ids;
+        s->size *= 2;
+    }
+
+    /*the range of the bitmap starts at the first element added to an empty set*/
+    if (s->n_ids == 0)
+    {
+        for (i = 0; i < (int)BITMAP_WORDS; i++)
+            s->bitmap[i] = 0;
+        s->dense = TRUE;
+        s->base = elementId - elementId % BITMAP_BITS;
+    }
+    if (s->dense == TRUE)
+    {
+        if (elementId >= s->base && elementId - s->base < BITMAP_BITS)
+            set_mark(s, elementId, TRUE);
+        else
+            s->dense = FALSE;
+    }
+
     /* Add the element to the set and increase the number of elements*/
     s->ids[s->n_ids] = elementId;
     s->n_ids++;
@@ -78,15 +192,19 @@ Status set_add(Set *s, Id elementId)
  * is NO_ID, it returns ERROR */
 Status set_del(Set *s, Id elementId)
 {
-    int pos = set_get_pos_from_Id(s, elementId);
+    int pos;
     if (!s || elementId == NO_ID)
         return ERROR;
 
-    if (!set_belongs(s, elementId) || set_is_empty(s))
+    /*a dense set tells with its bitmap that the element is missing without scanning, a sparse one scans only once*/
+    if ((s->dense == TRUE && !set_belongs(s, elementId)) || (pos = set_find(s, elementId)) == -1)
     {
         return ERROR;
     }
 
+    if (s->dense == TRUE)
+        set_mark(s, elementId, FALSE);
+
     s->n_ids--;
     /* Move the last element to the position of the removed element*/
     s->ids[pos] = s->ids[s->n_ids];
@@ -117,24 +235,20 @@ int set_print(Set *s)
 }
 
 /**This function checks if the specified element ID is present in the set.
- * It iterates through the elements in the set and returns TRUE if the element
- * is found, otherwise it returns FALSE */
+ * A dense set tests the bit of the element, a sparse set scans its elements once */
 Bool set_belongs(Set *s, Id elementId)
 {
-    int i;
-    Bool found = FALSE;
-    if (!s || elementId == NO_ID)
+    if (!s || elementId == NO_ID || s->n_ids == 0)
         return FALSE;
 
-    for (i = 0; i < s->n_ids && !found; i++)
+    if (s->dense == TRUE)
     {
-        if (s->ids[i] == elementId)
-        {
-            found = TRUE;
-        }
+        if (elementId < s->base || elementId - s->base >= BITMAP_BITS)
+            return FALSE;
+        return (s->bitmap[(elementId - s->base) / WORD_BITS] >> ((elementId - s->base) % WORD_BITS)) & 1UL ? TRUE : FALSE;
     }
 
-    return found;
+    return set_find(s, elementId) != -1 ? TRUE : FALSE;
 }
 
 /**This function determines whether the provided set is empty.
@@ -153,10 +267,10 @@ Bool set_is_empty(Set *s)
 }
 
 /**This function determines whether the provided set is full.
- * A set is considered full if it is either NULL or contains the maximum number of elements allowed */
+ * Sets grow as elements are added, so only a NULL set is considered full */
 Bool set_is_full(Set *s)
 {
-    if (!s || s->n_ids == MAX_ELEMENTS_IN_SET)
+    if (!s)
     {
         return TRUE;
     }
@@ -187,17 +301,35 @@ Id set_get_Id_in_pos(Set *s, int pos)
 /**This function returns the position of the specified ID within the given set. */
 int set_get_pos_from_Id(Set *s, Id elementId)
 {
-    int i;
-    if (!s || elementId == NO_ID || !set_belongs(s, elementId))
+    if (!s || elementId == NO_ID)
     {
         return -1;
     }
-    for (i = 0; i < s->n_ids; i++)
+    return set_find(s, elementId);
+}
+
+int set_find(Set *s, Id elementId)
+{
+    Id *ids = s->ids;
+    int i, n_ids = s->n_ids;
+
+    /*a plain loop over the contiguous array, which the compiler can unroll and vectorize*/
+    for (i = 0; i < n_ids; i++)
     {
-        if (s->ids[i] == elementId)
+        if (ids[i] == elementId)
         {
             return i;
         }
     }
     return -1;
-}
\ No newline at end of file
+}
+
+void set_mark(Set *s, Id elementId, Bool value)
+{
+    Id offset = elementId - s->base;
+
+    if (value == TRUE)
+        s->bitmap[offset / WORD_BITS] |= 1UL << (offset % WORD_BITS);
+    else
+        s->bitmap[offset / WORD_BITS] &= ~(1UL << (offset % WORD_BITS));
+}
@@ -0,0 +1,201 @@
+/**
+ * @brief It measures the set module against the fixed array set it replaced
+ *
+ * @file set_bench.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "set.h"
+
+#define ROUNDS 200000     /*!<Number of times each workload is repeated*/
+#define FAR_ID 100000     /*!<Id far from the others, used to make the sets sparse*/
+#define N_WORKLOADS 3     /*!<Number of workloads measured*/
+#define N_QUERIES 64      /*!<Number of ids looked up in each round*/
+
+/**
+ * @brief Set as it was before the bitmap: a fixed array scanned linearly, kept here to compare with
+ * @author agent
+ */
+typedef struct
+{
+  int n_ids;                   /*!<Number of elements in the set*/
+  Id ids[MAX_ELEMENTS_IN_SET]; /*!<Id of elements in the set*/
+} Array_set;
+
+/**
+ * @brief Sizes and ids of the sets measured
+ * @author agent
+ */
+typedef struct
+{
+  char *name;     /*!<Description of the workload*/
+  int n_elements; /*!<Number of elements of the set*/
+  Id first;       /*!<Id of the first element, the rest follow it*/
+  Bool sparse;    /*!<TRUE if an element far from the others is added as well*/
+} Workload;
+
+/*Private functions*/
+
+/**
+ * @brief Tells if an id is in an array set, the way set_belongs used to
+ * @author agent
+ * @param s the set
+ * @param id the id
+ * @return TRUE if the id is in the set
+ */
+Bool array_set_belongs(Array_set *s, Id id);
+
+/**
+ * @brief Adds an id to an array set, the way set_add used to
+ * @author agent
+ * @param s the set
+ * @param id the id
+ * @return Status OK or ERROR
+ */
+Status array_set_add(Array_set *s, Id id);
+
+/**
+ * @brief Deletes an id from an array set, the way set_del used to (scanning for the id twice)
+ * @author agent
+ * @param s the set
+ * @param id the id
+ * @return Status OK or ERROR
+ */
+Status array_set_del(Array_set *s, Id id);
+
+/**
+ * @brief Gets the nanoseconds spent on each operation
+ * @author agent
+ * @param start the clock when the workload started
+ * @param n_operations the number of operations done
+ * @return the nanoseconds per operation
+ */
+double bench_ns(clock_t start, long n_operations);
+
+/*End of private functions*/
+
+/**
+ * @brief main function of the benchmark, it prints the time of the lookups and of the add and delete pairs of both sets
+ * @author agent
+ * @return int: 1 if an error occurs and 0 if no errors occur
+ */
+int main()
+{
+  Workload workloads[N_WORKLOADS] = {{"dense, 4 elements", 4, 1, FALSE}, {"dense, 29 elements", 29, 1, FALSE}, {"sparse, 29 elements", 28, 1, TRUE}};
+  Array_set array_set;
+  Set *set = NULL;
+  Id queries[N_QUERIES];
+  long round, hits = 0;
+  clock_t start;
+  int w, i;
+
+  printf("%-22s %12s %12s %12s %12s\n", "workload", "old belongs", "new belongs", "old add+del", "new add+del");
+  for (w = 0; w < N_WORKLOADS; w++)
+  {
+    if (!(set = set_create()))
+      return 1;
+    array_set.n_ids = 0;
+    for (i = 0; i < workloads[w].n_elements; i++)
+    {
+      array_set_add(&array_set, workloads[w].first + i);
+      set_add(set, workloads[w].first + i);
+    }
+    if (workloads[w].sparse == TRUE)
+    {
+      array_set_add(&array_set, FAR_ID);
+      set_add(set, FAR_ID);
+    }
+    /*Half of the queries hit and half miss, like looking up the objects of a space*/
+    for (i = 0; i < N_QUERIES; i++)
+      queries[i] = (i % 2 == 0) ? workloads[w].first + (i / 2) % workloads[w].n_elements : workloads[w].first + workloads[w].n_elements + i;
+
+    printf("%-22s", workloads[w].name);
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++)
+      for (i = 0; i < N_QUERIES; i++)
+        hits += array_set_belongs(&array_set, queries[i]);
+    printf(" %9.2f ns", bench_ns(start, (long)ROUNDS * N_QUERIES));
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++)
+      for (i = 0; i < N_QUERIES; i++)
+        hits += set_belongs(set, queries[i]);
+    printf(" %9.2f ns", bench_ns(start, (long)ROUNDS * N_QUERIES));
+
+    /*An element that is already there is taken out and put back, like an object moving between spaces*/
+    start = clock();
+    for (round = 0; round < ROUNDS; round++)
+    {
+      array_set_del(&array_set, workloads[w].first);
+      array_set_add(&array_set, workloads[w].first);
+    }
+    printf(" %9.2f ns", bench_ns(start, ROUNDS));
+
+    start = clock();
+    for (round = 0; round < ROUNDS; round++)
+    {
+      set_del(set, workloads[w].first);
+      set_add(set, workloads[w].first);
+    }
+    printf(" %9.2f ns\n", bench_ns(start, ROUNDS));
+
+    set_destroy(set);
+  }
+
+  /*The hits are printed so the lookups are not optimized away*/
+  printf("(%ld hits)\n", hits);
+  return 0;
+}
+
+Bool array_set_belongs(Array_set *s, Id id)
+{
+  int i;
+  Bool found = FALSE;
+
+  for (i = 0; i < s->n_ids && !found; i++)
+  {
+    if (s->ids[i] == id)
+      found = TRUE;
+  }
+  return found;
+}
+
+Status array_set_add(Array_set *s, Id id)
+{
+  if (s->n_ids == MAX_ELEMENTS_IN_SET)
+    return ERROR;
+  if (array_set_belongs(s, id))
+    return OK;
+  s->ids[s->n_ids] = id;
+  s->n_ids++;
+  return OK;
+}
+
+Status array_set_del(Array_set *s, Id id)
+{
+  int i, pos = -1;
+
+  if (!array_set_belongs(s, id))
+    return ERROR;
+  for (i = 0; i < s->n_ids && pos == -1; i++)
+  {
+    if (s->ids[i] == id)
+      pos = i;
+  }
+  s->n_ids--;
+  s->ids[pos] = s->ids[s->n_ids];
+  return OK;
+}
+
+double bench_ns(clock_t start, long n_operations)
+{
+  return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / n_operations;
+}
@@ -13,7 +13,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 38    /*!<Total number of test functions for the Set module*/
+#define MAX_TESTS 43    /*!<Total number of test functions for the Set module*/
 #define ID_1 1          /*!<Id value that will be used to test set functions*/
 #define ID_2 2          /*!<Id value that will be used to test set functions*/
 #define ID_3 3          /*!<Id value that will be used to test set functions*/
@@ -21,6 +21,7 @@
 #define INVALID_POS1 -1 /*!<Value that serves as an invalid position in the tests*/
 #define INVALID_POS2 2  /*!<Value that serves as an invalid position in the tests*/
 #define ERROR_CODE -1   /*!<Error code retruned by several of the functions that return integers*/
+#define FAR_ID 100000   /*!<Id value far from the others, so the set holding it is sparse*/
 /**
  * @brief Main function for SET unit tests.
  *
@@ -128,6 +129,16 @@ int main(int argc, char **argv)
     test2_set_is_full();
   if (all || test == 38)
     test3_set_is_full();
+  if (all || test == 39)
+    test5_set_add();
+  if (all || test == 40)
+    test5_set_belongs();
+  if (all || test == 41)
+    test5_set_del();
+  if (all || test == 42)
+    test1_set_create_in_arena();
+  if (all || test == 43)
+    test1_set_copy_in_arena();
 
   PRINT_PASSED_PERCENTAGE;
 
@@ -358,7 +369,7 @@ void test3_set_is_full()
   {
     set_add(s, (long)(i + 1));
   }
-  PRINT_TEST_RESULT(result = (set_is_full(s) == TRUE));
+  PRINT_TEST_RESULT(result = (set_is_full(s) == FALSE));
   set_destroy(s);
 }
 
@@ -482,4 +493,70 @@ void test4_set_get_pos_from_Id()
   set_add(s, ID_2);
   PRINT_TEST_RESULT(result = (set_get_pos_from_Id(s, ID_2) == 1));
   set_destroy(s);
-}
\ No newline at end of file
+}
+
+void test5_set_add()
+{
+  int result, i;
+  Set *s;
+  s = set_create();
+  for (i = 0; i < MAX_ELEMENTS_IN_SET + 10; i++)
+  {
+    set_add(s, (long)(i + 1));
+  }
+  PRINT_TEST_RESULT(result = (set_get_num_elements(s) == MAX_ELEMENTS_IN_SET + 10 && set_belongs(s, MAX_ELEMENTS_IN_SET + 10) == TRUE && set_get_Id_in_pos(s, MAX_ELEMENTS_IN_SET) == MAX_ELEMENTS_IN_SET + 1));
+  set_destroy(s);
+}
+
+void test5_set_belongs()
+{
+  int result;
+  Set *s;
+  s = set_create();
+  set_add(s, ID_1);
+  set_add(s, FAR_ID);
+  PRINT_TEST_RESULT(result = (set_belongs(s, ID_1) == TRUE && set_belongs(s, FAR_ID) == TRUE && set_belongs(s, ID_2) == FALSE));
+  set_destroy(s);
+}
+
+void test5_set_del()
+{
+  int result;
+  Set *s;
+  s = set_create();
+  set_add(s, ID_1);
+  set_add(s, FAR_ID);
+  set_add(s, ID_2);
+  PRINT_TEST_RESULT(result = (set_del(s, FAR_ID) == OK && set_belongs(s, FAR_ID) == FALSE && set_belongs(s, ID_2) == TRUE && set_get_pos_from_Id(s, ID_2) == 1));
+  set_destroy(s);
+}
+
+void test1_set_create_in_arena()
+{
+  int result, i;
+  Arena *arena = arena_create();
+  Set *s;
+  s = set_create_in_arena(arena);
+  for (i = 0; i < MAX_ELEMENTS_IN_SET + 5; i++)
+  {
+    set_add(s, (long)(i + 1));
+  }
+  PRINT_TEST_RESULT(result = (s != NULL && set_get_num_elements(s) == MAX_ELEMENTS_IN_SET + 5 && set_belongs(s, ID_1) == TRUE && set_destroy(s) == OK));
+  arena_destroy(arena);
+}
+
+void test1_set_copy_in_arena()
+{
+  Arena *arena = arena_create();
+  Set *s = set_create(), *copy = NULL;
+  int i;
+  for (i = 0; i < MAX_ELEMENTS_IN_SET + 5; i++)
+  {
+    set_add(s, (long)(i + 1));
+  }
+  copy = set_copy_in_arena(arena, s);
+  set_del(s, ID_1);
+  PRINT_TEST_RESULT(copy != NULL && set_get_num_elements(copy) == MAX_ELEMENTS_IN_SET + 5 && set_belongs(copy, ID_1) == TRUE && set_get_Id_in_pos(copy, 1) == ID_2);
+  set_destroy(s);
+  arena_destroy(arena);
+}
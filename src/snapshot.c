@@ -0,0 +1,909 @@
+/**
+ * @brief It implements the snapshots of the state of a game
+ *
+ * @file snapshot.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "snapshot.h"
+#include "hash.h"
+#include "saver.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SNAPSHOT_MAGIC "GAMESNAP"       /*!<First bytes of every snapshot*/
+#define SNAPSHOT_MAGIC_SIZE 8           /*!<Number of bytes of the magic, without the '\0'*/
+#define SNAPSHOT_BYTE_ORDER 0x01020304L /*!<Value written in the header to detect snapshots saved with another byte order*/
+#define POOL_CHUNK 512                  /*!<Number of bytes the string pool grows each time it is full*/
+#define N_HISTORY 3                     /*!<Number of commands in the history of each interface*/
+
+/**
+ * @brief Tables of the snapshot, in the order they are written
+ * @author agent
+ */
+typedef enum
+{
+  GAME_STATES,      /*!<One Game_state*/
+  SPACE_STATES,     /*!<Space_state for each space, in the order of the game*/
+  OBJECT_STATES,    /*!<Object_state for each object, including the removed ones*/
+  PLAYER_STATES,    /*!<Player_state for each player, in the order of the game*/
+  CHARACTER_STATES, /*!<Character_state for each character, in the order of the game*/
+  LINK_STATES,      /*!<Link_state for each link, in the order of the game*/
+  MISSION_STATES,   /*!<Mission_state for each mission, in the order of the game*/
+  INTERFACE_STATES, /*!<Interface_state for each player, in the order of the game*/
+  BACKPACK_IDS,     /*!<Ids of the objects in the backpacks of the players*/
+  N_STATE_TABLES    /*!<Number of tables*/
+} Snapshot_table_type;
+
+/**
+ * @brief Position of a table in the snapshot
+ * @author agent
+ */
+typedef struct
+{
+  long offset; /*!<Byte of the snapshot where the table starts*/
+  long count;  /*!<Number of records of the table*/
+} Snapshot_table;
+
+/**
+ * @brief Header at the start of every snapshot
+ * @author agent
+ */
+typedef struct
+{
+  char magic[SNAPSHOT_MAGIC_SIZE];       /*!<SNAPSHOT_MAGIC*/
+  long version;                          /*!<SNAPSHOT_VERSION of the game that saved it*/
+  long byte_order;                       /*!<SNAPSHOT_BYTE_ORDER, as written by the game that saved it*/
+  long long_size;                        /*!<Size of long for the game that saved it*/
+  long size;                             /*!<Size of the whole snapshot*/
+  unsigned long checksum;                /*!<Checksum of every byte after the header*/
+  unsigned long world;                   /*!<Hash of the world of the game, see snapshot_world_hash*/
+  Snapshot_table tables[N_STATE_TABLES]; /*!<Tables of records*/
+  long pool_offset;                      /*!<Byte of the snapshot where the string pool starts*/
+  long pool_size;                        /*!<Size of the string pool*/
+} Snapshot_header;
+
+/**
+ * @brief State of the game itself
+ * @author agent
+ */
+typedef struct
+{
+  long turn;              /*!<Position of the player whose turn it is*/
+  long current_cinematic; /*!<Cinematic being played*/
+  long current_mission;   /*!<Code of the mission being played*/
+  long lights_on;         /*!<1 if the lights are on*/
+  unsigned long random[RNG_STATE_SIZE]; /*!<State of the generator of random numbers*/
+} Game_state;
+
+/**
+ * @brief State of a space
+ * @author agent
+ */
+typedef struct
+{
+  long discovered; /*!<1 if the space is discovered*/
+} Space_state;
+
+/**
+ * @brief State of an object
+ * @author agent
+ */
+typedef struct
+{
+  long id;         /*!<Id of the object, the objects change their order when one is removed*/
+  long removed;    /*!<1 if the object has been removed from the game*/
+  long location;   /*!<Space where the object is, NO_ID if it is not in one*/
+  long movable;    /*!<1 if the object can be taken*/
+  long health;     /*!<Health the object gives*/
+  long dependency; /*!<Object it depends on*/
+  long open;       /*!<Link the object opens*/
+} Object_state;
+
+/**
+ * @brief State of a player
+ * @author agent
+ */
+typedef struct
+{
+  long location;     /*!<Space where the player is*/
+  long health;       /*!<Health of the player*/
+  long max_objects;  /*!<Size of the backpack*/
+  long team;         /*!<Team of the player*/
+  long first_object; /*!<Position in the BACKPACK_IDS table of the first object of the backpack*/
+  long n_objects;    /*!<Number of objects in the backpack*/
+} Player_state;
+
+/**
+ * @brief State of a character
+ * @author agent
+ */
+typedef struct
+{
+  long location;     /*!<Space where the character is*/
+  long health;       /*!<Health of the character*/
+  long friendly;     /*!<1 if the character is friendly*/
+  long following;    /*!<Player the character follows*/
+  long message_turn; /*!<Position of the next message the character says*/
+} Character_state;
+
+/**
+ * @brief State of a link
+ * @author agent
+ */
+typedef struct
+{
+  long open; /*!<1 if the link is open*/
+} Link_state;
+
+/**
+ * @brief State of a mission
+ * @author agent
+ */
+typedef struct
+{
+  long current_step;   /*!<Step the mission is in*/
+  long next_objective; /*!<Index of the next objective*/
+  long next_dialogue;  /*!<Index of the next dialogue*/
+} Mission_state;
+
+/**
+ * @brief A command of the history of an interface, the arguments are offsets in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long code;      /*!<Code of the command*/
+  long argument;  /*!<First argument*/
+  long argument2; /*!<Second argument*/
+  long success;   /*!<1 if the command succeeded*/
+} Command_state;
+
+/**
+ * @brief State of the interface of a player, the texts are offsets in the pool
+ * @author agent
+ */
+typedef struct
+{
+  Command_state history[N_HISTORY]; /*!<Last, second to last and third to last commands*/
+  long message;                     /*!<Message of the last character the player talked to*/
+  long description;                 /*!<Description of the last object the player inspected*/
+  long objective;                   /*!<Text of the next objective*/
+  long show_message;                /*!<1 if the message is shown*/
+} Interface_state;
+
+/**
+ * @brief Snapshot being saved or loaded
+ * @author agent
+ */
+typedef struct
+{
+  char *data;              /*!<Header and tables of the snapshot (the whole snapshot once loaded)*/
+  Snapshot_header *header; /*!<Header, at the start of data*/
+  char *pool;              /*!<String pool*/
+  long pool_size;          /*!<Bytes used in the pool*/
+  long pool_cap;           /*!<Bytes allocated for the pool while saving*/
+  Status status;           /*!<ERROR once something has failed while saving*/
+} Snapshot;
+
+static size_t state_size[N_STATE_TABLES] = {sizeof(Game_state), sizeof(Space_state), sizeof(Object_state), sizeof(Player_state), sizeof(Character_state), sizeof(Link_state), sizeof(Mission_state), sizeof(Interface_state), sizeof(long)}; /*!<Size of the records of each table*/
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets a record of a table of the snapshot
+ * @author agent
+ * @param snapshot the snapshot
+ * @param table the table
+ * @param pos position of the record in the table
+ * @return a pointer to the record
+ */
+void *snapshot_record(Snapshot *snapshot, Snapshot_table_type table, long pos);
+
+/**
+ * @brief Copies a string to the pool of a snapshot being saved
+ * @author agent
+ * @param snapshot the snapshot
+ * @param str the string, NULL is stored as an empty one
+ * @return the offset of the string in the pool
+ */
+long snapshot_add_string(Snapshot *snapshot, const char *str);
+
+/**
+ * @brief Fills the tables of a snapshot being saved with the state of a game
+ * @author agent
+ * @param snapshot the snapshot, with its tables already allocated
+ * @param game the game
+ */
+void snapshot_save_tables(Snapshot *snapshot, Game *game);
+
+/**
+ * @brief Checks that a mapped snapshot is valid and was saved from the world of a game, so its records can be trusted
+ * @author agent
+ * @param snapshot the snapshot
+ * @param size the size of the file
+ * @param game the game it is going to be loaded into
+ * @return Status OK or ERROR
+ */
+Status snapshot_check(Snapshot *snapshot, long size, Game *game);
+
+/**
+ * @brief Gets a string of the pool of a loaded snapshot
+ * @author agent
+ * @param snapshot the snapshot
+ * @param offset the offset of the string
+ * @param size the size of the buffer the string is copied to, with the '\0'
+ * @return the string, or NULL if the offset is outside the pool or the string does not fit in the buffer
+ */
+char *snapshot_string(Snapshot *snapshot, long offset, size_t size);
+
+/**
+ * @brief Tells if an id read from a snapshot is NO_ID or the id of a space of the game
+ * @author agent
+ * @param game the game
+ * @param id the id
+ * @return TRUE if it is, FALSE otherwise
+ */
+Bool snapshot_is_location(Game *game, long id);
+
+/**
+ * @brief Tells if an id read from a snapshot is the id of one of its objects, removed or not
+ * @author agent
+ * @param snapshot the snapshot
+ * @param id the id
+ * @return TRUE if it is, FALSE otherwise
+ */
+Bool snapshot_has_object(Snapshot *snapshot, long id);
+
+/**
+ * @brief Sets the state of the records of a loaded snapshot on the entities of a game
+ * @author agent
+ * @param snapshot the snapshot, already checked
+ * @param game the game
+ * @return Status OK or ERROR
+ */
+Status snapshot_load_tables(Snapshot *snapshot, Game *game);
+
+/**
+ * @brief Sets a command of the history of an interface from its record
+ * @author agent
+ * @param snapshot the snapshot
+ * @param command the command
+ * @param state the record
+ * @return Status OK or ERROR
+ */
+Status snapshot_load_command(Snapshot *snapshot, Command *command, Command_state *state);
+
+/**
+ * @brief Adds a string to a hash, with its '\0' so consecutive strings can not be mistaken for others
+ * @author agent
+ * @param hash the hash of the previous content
+ * @param str the string, NULL is taken as an empty one
+ * @return the new hash
+ */
+unsigned long snapshot_hash_string(unsigned long hash, const char *str);
+
+/**
+ * @brief Adds a number to a hash
+ * @author agent
+ * @param hash the hash of the previous content
+ * @param value the number
+ * @return the new hash
+ */
+unsigned long snapshot_hash_long(unsigned long hash, long value);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Bool snapshot_is_snapshot(char *filename)
+{
+  FILE *file = NULL;
+  char magic[SNAPSHOT_MAGIC_SIZE];
+  Bool is_snapshot = FALSE;
+
+  if (!filename || !(file = fopen(filename, "rb")))
+    return FALSE;
+
+  if (fread(magic, 1, SNAPSHOT_MAGIC_SIZE, file) == SNAPSHOT_MAGIC_SIZE && memcmp(magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) == 0)
+    is_snapshot = TRUE;
+
+  fclose(file);
+  return is_snapshot;
+}
+
+Status snapshot_save(Game *game, char *filename)
+{
+  char *data = NULL;
+  long size;
+  Status status;
+
+  if (!game || !filename)
+    return ERROR;
+
+  if (snapshot_build(game, &data, &size) == ERROR)
+    return ERROR;
+  status = saver_write(data, size, filename);
+  free(data);
+  return status;
+}
+
+Status snapshot_build(Game *game, char **data, long *size)
+{
+  Snapshot snapshot;
+  long counts[N_STATE_TABLES];
+  long tables_size;
+  int i;
+
+  if (!game || !data || !size)
+    return ERROR;
+
+  counts[GAME_STATES] = 1;
+  counts[SPACE_STATES] = game_get_n_spaces(game);
+  counts[OBJECT_STATES] = game_get_n_objects(game) + game_get_n_removed_objects(game);
+  counts[PLAYER_STATES] = counts[INTERFACE_STATES] = game_get_n_players(game);
+  counts[CHARACTER_STATES] = game_get_n_characters(game);
+  counts[LINK_STATES] = game_get_n_links(game);
+  counts[MISSION_STATES] = game_get_n_missions(game);
+  counts[BACKPACK_IDS] = 0;
+  for (i = 0; i < counts[PLAYER_STATES]; i++)
+    counts[BACKPACK_IDS] += player_get_num_objects_in_backpack(game_get_player_in_pos(game, i));
+
+  /*The header and the tables are allocated at once, the pool grows as the strings are added*/
+  tables_size = sizeof(Snapshot_header);
+  for (i = 0; i < N_STATE_TABLES; i++)
+    tables_size += counts[i] * state_size[i];
+
+  memset(&snapshot, 0, sizeof(Snapshot));
+  snapshot.status = OK;
+  if (!(snapshot.data = (char *)calloc(1, tables_size)))
+    return ERROR;
+  snapshot.header = (Snapshot_header *)snapshot.data;
+
+  memcpy(snapshot.header->magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE);
+  snapshot.header->version = SNAPSHOT_VERSION;
+  snapshot.header->byte_order = SNAPSHOT_BYTE_ORDER;
+  snapshot.header->long_size = sizeof(long);
+  snapshot.header->world = snapshot_world_hash(game);
+  snapshot.header->tables[0].offset = sizeof(Snapshot_header);
+  for (i = 0; i < N_STATE_TABLES; i++)
+  {
+    if (i > 0)
+      snapshot.header->tables[i].offset = snapshot.header->tables[i - 1].offset + snapshot.header->tables[i - 1].count * state_size[i - 1];
+    snapshot.header->tables[i].count = counts[i];
+  }
+
+  snapshot_save_tables(&snapshot, game);
+
+  /*The pool is put right after the tables, so the snapshot is written with a single write*/
+  if (snapshot.status == OK && snapshot.pool_size > 0)
+  {
+    if (!(*data = (char *)realloc(snapshot.data, tables_size + snapshot.pool_size)))
+      snapshot.status = ERROR;
+    else
+      snapshot.data = *data;
+  }
+
+  if (snapshot.status == OK)
+  {
+    snapshot.header = (Snapshot_header *)snapshot.data;
+    memcpy(snapshot.data + tables_size, snapshot.pool, snapshot.pool_size);
+    snapshot.header->pool_offset = tables_size;
+    snapshot.header->pool_size = snapshot.pool_size;
+    snapshot.header->size = tables_size + snapshot.pool_size;
+    snapshot.header->checksum = hash_bytes(HASH_START, snapshot.data + sizeof(Snapshot_header), snapshot.header->size - sizeof(Snapshot_header));
+    *data = snapshot.data;
+    *size = snapshot.header->size;
+  }
+  else
+  {
+    free(snapshot.data);
+  }
+
+  free(snapshot.pool);
+  return snapshot.status;
+}
+
+Status snapshot_load(Game *game, char *filename)
+{
+  Snapshot snapshot;
+  struct stat info;
+  Status status = ERROR;
+  int fd;
+
+  if (!game || !filename)
+    return ERROR;
+
+  if ((fd = open(filename, O_RDONLY)) == -1)
+    return ERROR;
+
+  if (fstat(fd, &info) == -1 || info.st_size < (off_t)sizeof(Snapshot_header))
+  {
+    close(fd);
+    return ERROR;
+  }
+
+  memset(&snapshot, 0, sizeof(Snapshot));
+  snapshot.data = (char *)mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (snapshot.data == MAP_FAILED)
+    return ERROR;
+  snapshot.header = (Snapshot_header *)snapshot.data;
+
+  if (snapshot_check(&snapshot, (long)info.st_size, game) == OK)
+    status = snapshot_load_tables(&snapshot, game);
+
+  munmap(snapshot.data, info.st_size);
+  return status;
+}
+
+unsigned long snapshot_world_hash(Game *game)
+{
+  Space *space = NULL;
+  Object *object = NULL;
+  Player *player = NULL;
+  Character *character = NULL;
+  Link *link = NULL;
+  Mission *mission = NULL;
+  Cinematics_text *cinematic = NULL;
+  char **gdesc = NULL;
+  unsigned long hash, objects;
+  int i, j;
+
+  if (!game)
+    return 0;
+  if ((hash = game_get_world_hash(game)) != 0)
+    return hash;
+
+  hash = HASH_START;
+  for (i = 0; i < game_get_n_spaces(game); i++)
+  {
+    space = game_get_space_in_pos(game, i);
+    hash = snapshot_hash_string(snapshot_hash_long(hash, space_get_id(space)), space_get_name(space));
+    gdesc = space_get_gdesc(space);
+    for (j = 0; j < N_TOTAL_ROWS_IN_SQUARE && gdesc; j++)
+      hash = snapshot_hash_string(hash, gdesc[j]);
+  }
+  /*The objects change their order when one is removed, so their hashes are added up, which does not depend on it*/
+  objects = 0;
+  for (i = 0; i < game_get_n_objects(game) + game_get_n_removed_objects(game); i++)
+  {
+    object = i < game_get_n_objects(game) ? game_get_object_in_pos(game, i) : game_get_removed_object_in_pos(game, i - game_get_n_objects(game));
+    objects += snapshot_hash_string(snapshot_hash_string(snapshot_hash_string(snapshot_hash_long(HASH_START, object_get_id(object)), object_get_name(object)), object_get_gdesc(object)), object_get_description(object));
+  }
+  hash = snapshot_hash_long(hash, (long)(objects & 0xFFFFFFFFUL));
+  for (i = 0; i < game_get_n_players(game); i++)
+  {
+    player = game_get_player_in_pos(game, i);
+    hash = snapshot_hash_string(snapshot_hash_string(snapshot_hash_long(hash, player_get_id(player)), player_get_name(player)), player_get_gdesc(player));
+  }
+  for (i = 0; i < game_get_n_characters(game); i++)
+  {
+    character = game_get_character_in_pos(game, i);
+    hash = snapshot_hash_string(snapshot_hash_string(snapshot_hash_string(snapshot_hash_long(hash, character_get_id(character)), character_get_name(character)), character_get_gdesc(character)), character_get_dead_gdesc(character));
+    for (j = 0; j < character_get_n_messages(character); j++)
+      hash = snapshot_hash_string(hash, character_get_message_in_pos(character, j));
+  }
+  for (i = 0; i < game_get_n_links(game); i++)
+  {
+    link = game_get_link_in_pos(game, i);
+    hash = snapshot_hash_string(snapshot_hash_long(hash, link_get_id(link)), link_get_name(link));
+    hash = snapshot_hash_long(snapshot_hash_long(snapshot_hash_long(hash, link_get_origin_id(link)), link_get_destination_id(link)), link_get_direction(link));
+  }
+  for (i = 0; i < game_get_n_missions(game); i++)
+  {
+    mission = game_get_mission_in_pos(game, i);
+    hash = snapshot_hash_long(hash, mission_get_code(mission));
+    for (j = 0; j < mission_get_n_objectives(mission); j++)
+      hash = snapshot_hash_string(hash, mission_get_objective_in_pos(mission, j));
+    for (j = 0; j < mission_get_n_dialogues(mission); j++)
+      hash = snapshot_hash_string(hash, mission_get_dialogue_in_pos(mission, j));
+  }
+  for (i = 0; i < N_CINEMATICS; i++)
+  {
+    cinematic = game_get_cinematic_text_in_pos(game, i);
+    for (j = 0; j < cinematics_get_n_lines(cinematic); j++)
+      hash = snapshot_hash_string(hash, cinematics_get_line(cinematic, j));
+  }
+
+  /*0 means that the hash has not been computed, so it is never used as a hash*/
+  if (hash == 0)
+    hash = 1;
+  game_set_world_hash(game, hash);
+  return hash;
+}
+
+void *snapshot_record(Snapshot *snapshot, Snapshot_table_type table, long pos)
+{
+  return snapshot->data + snapshot->header->tables[table].offset + pos * state_size[table];
+}
+
+long snapshot_add_string(Snapshot *snapshot, const char *str)
+{
+  char *pool = NULL;
+  long len, offset;
+
+  if (snapshot->status == ERROR)
+    return 0;
+  if (!str)
+    str = "";
+
+  len = strlen(str) + 1;
+  if (snapshot->pool_size + len > snapshot->pool_cap)
+  {
+    if (!(pool = (char *)realloc(snapshot->pool, snapshot->pool_cap + len + POOL_CHUNK)))
+    {
+      snapshot->status = ERROR;
+      return 0;
+    }
+    snapshot->pool = pool;
+    snapshot->pool_cap += len + POOL_CHUNK;
+  }
+
+  offset = snapshot->pool_size;
+  memcpy(snapshot->pool + offset, str, len);
+  snapshot->pool_size += len;
+  return offset;
+}
+
+void snapshot_save_tables(Snapshot *snapshot, Game *game)
+{
+  Game_state *game_state = NULL;
+  Space_state *space_state = NULL;
+  Object_state *object_state = NULL;
+  Player_state *player_state = NULL;
+  Character_state *character_state = NULL;
+  Link_state *link_state = NULL;
+  Mission_state *mission_state = NULL;
+  Interface_state *interface_state = NULL;
+  Command *history[N_HISTORY];
+  Object *object = NULL;
+  Player *player = NULL;
+  Character *character = NULL;
+  Mission *mission = NULL;
+  long n_ids = 0;
+  int i, j;
+
+  game_state = (Game_state *)snapshot_record(snapshot, GAME_STATES, 0);
+  game_state->turn = game_get_turn(game);
+  game_state->current_cinematic = game_get_current_cinematic(game);
+  game_state->current_mission = game_get_current_mission_code(game);
+  game_state->lights_on = game_get_lights_on(game) == TRUE ? 1 : 0;
+  rng_get_state(game_get_rng(game), game_state->random);
+
+  for (i = 0; i < game_get_n_spaces(game); i++)
+  {
+    space_state = (Space_state *)snapshot_record(snapshot, SPACE_STATES, i);
+    space_state->discovered = space_get_discovered(game_get_space_in_pos(game, i)) == TRUE ? 1 : 0;
+  }
+
+  /*The objects still in the game come first, followed by the removed ones*/
+  for (i = 0; i < game_get_n_objects(game) + game_get_n_removed_objects(game); i++)
+  {
+    object_state = (Object_state *)snapshot_record(snapshot, OBJECT_STATES, i);
+    if (i < game_get_n_objects(game))
+    {
+      object = game_get_object_in_pos(game, i);
+      object_state->removed = 0;
+      object_state->location = game_get_object_location(game, object_get_id(object));
+    }
+    else
+    {
+      object = game_get_removed_object_in_pos(game, i - game_get_n_objects(game));
+      object_state->removed = 1;
+      object_state->location = NO_ID;
+    }
+    object_state->id = object_get_id(object);
+    object_state->movable = object_get_movable(object) == TRUE ? 1 : 0;
+    object_state->health = object_get_health(object);
+    object_state->dependency = object_get_dependency(object);
+    object_state->open = object_get_open(object);
+  }
+
+  for (i = 0; i < game_get_n_players(game); i++)
+  {
+    player = game_get_player_in_pos(game, i);
+    player_state = (Player_state *)snapshot_record(snapshot, PLAYER_STATES, i);
+    player_state->location = player_get_location(player);
+    player_state->health = player_get_health(player);
+    player_state->max_objects = inventory_get_max_objs(player_get_inventory(player));
+    player_state->team = player_get_team(player);
+    player_state->first_object = n_ids;
+    player_state->n_objects = player_get_num_objects_in_backpack(player);
+    for (j = 0; j < player_state->n_objects; j++)
+      *(long *)snapshot_record(snapshot, BACKPACK_IDS, n_ids++) = player_get_backpack_object_id_at(player, j);
+
+    interface_state = (Interface_state *)snapshot_record(snapshot, INTERFACE_STATES, i);
+    history[0] = game_interface_in_pos_get_lastCmd(game, i);
+    history[1] = game_interface_in_pos_get_second_to_last_Cmd(game, i);
+    history[2] = game_interface_in_pos_get_third_to_last_Cmd(game, i);
+    for (j = 0; j < N_HISTORY; j++)
+    {
+      interface_state->history[j].code = command_get_code(history[j]);
+      interface_state->history[j].argument = snapshot_add_string(snapshot, command_get_argument(history[j]));
+      interface_state->history[j].argument2 = snapshot_add_string(snapshot, command_get_argument2(history[j]));
+      interface_state->history[j].success = command_get_lastcmd_success(history[j]) == OK ? 1 : 0;
+    }
+    interface_state->message = snapshot_add_string(snapshot, game_interface_in_pos_get_message(game, i));
+    interface_state->description = snapshot_add_string(snapshot, game_interface_in_pos_get_description(game, i));
+    interface_state->objective = snapshot_add_string(snapshot, game_interface_in_pos_get_objective(game, i));
+    interface_state->show_message = game_get_show_message(game, i) == TRUE ? 1 : 0;
+  }
+
+  for (i = 0; i < game_get_n_characters(game); i++)
+  {
+    character = game_get_character_in_pos(game, i);
+    character_state = (Character_state *)snapshot_record(snapshot, CHARACTER_STATES, i);
+    character_state->location = character_get_location(character);
+    character_state->health = character_get_health(character);
+    character_state->friendly = character_get_friendly(character) == TRUE ? 1 : 0;
+    character_state->following = character_get_following(character);
+    character_state->message_turn = character_get_message_turn(character);
+  }
+
+  for (i = 0; i < game_get_n_links(game); i++)
+  {
+    link_state = (Link_state *)snapshot_record(snapshot, LINK_STATES, i);
+    link_state->open = link_get_is_open(game_get_link_in_pos(game, i)) == TRUE ? 1 : 0;
+  }
+
+  for (i = 0; i < game_get_n_missions(game); i++)
+  {
+    mission = game_get_mission_in_pos(game, i);
+    mission_state = (Mission_state *)snapshot_record(snapshot, MISSION_STATES, i);
+    mission_state->current_step = mission_get_current_step(mission);
+    mission_state->next_objective = mission_get_next_objective_index(mission);
+    mission_state->next_dialogue = mission_get_next_dialogue_index(mission);
+  }
+}
+
+Status snapshot_check(Snapshot *snapshot, long size, Game *game)
+{
+  Snapshot_header *header = snapshot->header;
+  long end = sizeof(Snapshot_header);
+  long counts[N_STATE_TABLES];
+  int i;
+
+  if (memcmp(header->magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) != 0 || header->version != SNAPSHOT_VERSION || header->long_size != (long)sizeof(long) || header->byte_order != SNAPSHOT_BYTE_ORDER || header->size != size)
+    return ERROR;
+
+  /*A snapshot of another world, or of a world whose files have changed, can not be applied to this one*/
+  if (header->world != snapshot_world_hash(game))
+    return ERROR;
+
+  /*The records are matched with the entities by their position, so there must be one for each*/
+  counts[GAME_STATES] = 1;
+  counts[SPACE_STATES] = game_get_n_spaces(game);
+  counts[OBJECT_STATES] = game_get_n_objects(game) + game_get_n_removed_objects(game);
+  counts[PLAYER_STATES] = counts[INTERFACE_STATES] = game_get_n_players(game);
+  counts[CHARACTER_STATES] = game_get_n_characters(game);
+  counts[LINK_STATES] = game_get_n_links(game);
+  counts[MISSION_STATES] = game_get_n_missions(game);
+
+  /*The tables must follow each other inside the snapshot, with the pool at the end*/
+  for (i = 0; i < N_STATE_TABLES; i++)
+  {
+    if (header->tables[i].offset != end || header->tables[i].count < 0 || header->tables[i].count > (size - end) / (long)state_size[i])
+      return ERROR;
+    if (i != BACKPACK_IDS && header->tables[i].count != counts[i])
+      return ERROR;
+    end += header->tables[i].count * state_size[i];
+  }
+  if (header->pool_offset != end || header->pool_size != size - end)
+    return ERROR;
+
+  snapshot->pool = snapshot->data + header->pool_offset;
+  snapshot->pool_size = header->pool_size;
+  /*Every string ends before the end of the pool*/
+  if (snapshot->pool_size > 0 && snapshot->pool[snapshot->pool_size - 1] != '\0')
+    return ERROR;
+
+  if (hash_bytes(HASH_START, snapshot->data + sizeof(Snapshot_header), size - sizeof(Snapshot_header)) != header->checksum)
+    return ERROR;
+
+  return OK;
+}
+
+char *snapshot_string(Snapshot *snapshot, long offset, size_t size)
+{
+  /*The pool ends with '\0', so the length is always found inside it*/
+  if (offset < 0 || offset >= snapshot->pool_size || strlen(snapshot->pool + offset) >= size)
+    return NULL;
+
+  return snapshot->pool + offset;
+}
+
+Bool snapshot_is_location(Game *game, long id)
+{
+  if (id == NO_ID || game_get_space(game, id))
+    return TRUE;
+  return FALSE;
+}
+
+Bool snapshot_has_object(Snapshot *snapshot, long id)
+{
+  long i;
+
+  for (i = 0; i < snapshot->header->tables[OBJECT_STATES].count; i++)
+  {
+    if (((Object_state *)snapshot_record(snapshot, OBJECT_STATES, i))->id == id)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+Status snapshot_load_tables(Snapshot *snapshot, Game *game)
+{
+  Game_state *game_state = NULL;
+  Space_state *space_state = NULL;
+  Object_state *object_state = NULL;
+  Player_state *player_state = NULL;
+  Character_state *character_state = NULL;
+  Link_state *link_state = NULL;
+  Mission_state *mission_state = NULL;
+  Interface_state *interface_state = NULL;
+  Snapshot_table *tables = snapshot->header->tables;
+  Command *history[N_HISTORY];
+  Object *object = NULL;
+  Player *player = NULL;
+  Character *character = NULL;
+  Mission *mission = NULL;
+  long i, j, id;
+
+  /*The values are checked before they are set: the checksum only detects accidents, a snapshot could have been written on purpose*/
+  game_state = (Game_state *)snapshot_record(snapshot, GAME_STATES, 0);
+  if (game_state->current_cinematic < 0 || game_state->current_cinematic > NO_CINEMATIC || game_state->current_mission < NO_MISSION || game_state->current_mission >= game_get_n_missions(game))
+    return ERROR;
+
+  /*Everything is placed again where the snapshot says*/
+  if (game_clear_placements(game) == ERROR)
+    return ERROR;
+
+  for (i = 0; i < tables[SPACE_STATES].count; i++)
+  {
+    space_state = (Space_state *)snapshot_record(snapshot, SPACE_STATES, i);
+    space_set_discovered(game_get_space_in_pos(game, (int)i), space_state->discovered == 1 ? TRUE : FALSE);
+  }
+
+  /*The objects are all taken out and those that were in the game are put back in the order of the snapshot, which is the one the game had*/
+  while (game_get_n_objects(game) > 0)
+  {
+    if (game_remove_object(game, game_get_object_in_pos(game, 0)) == FALSE)
+      return ERROR;
+  }
+  for (i = 0; i < tables[OBJECT_STATES].count; i++)
+  {
+    object_state = (Object_state *)snapshot_record(snapshot, OBJECT_STATES, i);
+    if (object_state->removed == 1)
+      continue;
+    if ((object_state->dependency != NO_ID && snapshot_has_object(snapshot, object_state->dependency) == FALSE) || (object_state->open != NO_ID && !game_get_link(game, object_state->open)))
+      return ERROR;
+    if (game_restore_object(game, object_state->id) == ERROR || !(object = game_get_object(game, object_state->id)))
+      return ERROR;
+    object_set_movable(object, object_state->movable == 1 ? TRUE : FALSE);
+    object_set_health(object, (int)object_state->health);
+    object_set_dependency(object, object_state->dependency);
+    object_set_open(object, object_state->open);
+    /*The objects in a backpack have no space, they are placed with the state of the player*/
+    if (object_state->location != NO_ID && space_add_objectId(game_get_space(game, object_state->location), object_get_id(object)) == ERROR)
+      return ERROR;
+  }
+
+  for (i = 0; i < tables[PLAYER_STATES].count; i++)
+  {
+    player = game_get_player_in_pos(game, (int)i);
+    player_state = (Player_state *)snapshot_record(snapshot, PLAYER_STATES, i);
+    if (player_state->first_object < 0 || player_state->n_objects < 0 || player_state->n_objects > tables[BACKPACK_IDS].count - player_state->first_object)
+      return ERROR;
+    if (snapshot_is_location(game, player_state->location) == FALSE || player_state->max_objects > INT_MAX)
+      return ERROR;
+    if (player_set_location(player, player_state->location) == ERROR || player_set_health(player, (int)player_state->health) == ERROR || player_set_max_objs(player, (int)player_state->max_objects) == ERROR || player_set_team(player, player_state->team) == ERROR)
+      return ERROR;
+    for (j = 0; j < player_state->n_objects; j++)
+    {
+      id = *(long *)snapshot_record(snapshot, BACKPACK_IDS, player_state->first_object + j);
+      if (!game_get_object(game, id) || player_add_object_to_backpack(player, id) == ERROR)
+        return ERROR;
+    }
+
+    interface_state = (Interface_state *)snapshot_record(snapshot, INTERFACE_STATES, i);
+    history[0] = game_interface_in_pos_get_lastCmd(game, (int)i);
+    history[1] = game_interface_in_pos_get_second_to_last_Cmd(game, (int)i);
+    history[2] = game_interface_in_pos_get_third_to_last_Cmd(game, (int)i);
+    for (j = 0; j < N_HISTORY; j++)
+    {
+      if (snapshot_load_command(snapshot, history[j], &interface_state->history[j]) == ERROR)
+        return ERROR;
+    }
+    if (!snapshot_string(snapshot, interface_state->message, DIALOGUE_LINE_LENGTH) || !snapshot_string(snapshot, interface_state->description, MAX_MESSAGE) || !snapshot_string(snapshot, interface_state->objective, MAX_MISSION_MESSAGE))
+      return ERROR;
+    game_interface_in_pos_set_message(game, (int)i, snapshot_string(snapshot, interface_state->message, DIALOGUE_LINE_LENGTH));
+    game_interface_in_pos_set_description(game, (int)i, snapshot_string(snapshot, interface_state->description, MAX_MESSAGE));
+    game_interface_in_pos_set_objective(game, (int)i, snapshot_string(snapshot, interface_state->objective, MAX_MISSION_MESSAGE));
+    game_set_show_message(game, interface_state->show_message == 1 ? TRUE : FALSE, (Protagonists)i);
+  }
+
+  for (i = 0; i < tables[CHARACTER_STATES].count; i++)
+  {
+    character = game_get_character_in_pos(game, (int)i);
+    character_state = (Character_state *)snapshot_record(snapshot, CHARACTER_STATES, i);
+    if (snapshot_is_location(game, character_state->location) == FALSE || (character_state->following != NO_ID && !game_get_player(game, character_state->following)))
+      return ERROR;
+    character_set_location(character, character_state->location);
+    character_set_health(character, (int)character_state->health);
+    character_set_friendly(character, character_state->friendly == 1 ? TRUE : FALSE);
+    character_set_following(character, character_state->following);
+    if (character_set_message_turn(character, (int)character_state->message_turn) == ERROR)
+      return ERROR;
+    space_add_character(game_get_space(game, character_state->location), character_get_id(character));
+  }
+
+  for (i = 0; i < tables[LINK_STATES].count; i++)
+  {
+    link_state = (Link_state *)snapshot_record(snapshot, LINK_STATES, i);
+    link_set_is_open(game_get_link_in_pos(game, (int)i), link_state->open == 1 ? TRUE : FALSE);
+  }
+
+  for (i = 0; i < tables[MISSION_STATES].count; i++)
+  {
+    mission = game_get_mission_in_pos(game, (int)i);
+    mission_state = (Mission_state *)snapshot_record(snapshot, MISSION_STATES, i);
+    /*The indexes are of the next objective and dialogue, one after the last one when they have all been shown*/
+    if (mission_state->current_step < 0 || mission_state->current_step > INT_MAX || mission_state->next_objective < 0 || mission_state->next_objective > mission_get_n_objectives(mission) ||
+        mission_state->next_dialogue < 0 || mission_state->next_dialogue > mission_get_n_dialogues(mission))
+      return ERROR;
+    mission_set_current_step(mission, (int)mission_state->current_step);
+    mission_set_next_objective(mission, (int)mission_state->next_objective);
+    mission_set_next_dialogue(mission, (int)mission_state->next_dialogue);
+  }
+
+  game_set_finished(game, FALSE);
+  game_set_current_cinematic(game, (Cinematics)game_state->current_cinematic);
+  if (game_set_turn(game, (TurnByPlayer)game_state->turn) == ERROR || game_set_lights_on(game, game_state->lights_on == 1 ? TRUE : FALSE) == ERROR)
+    return ERROR;
+  if (game_set_current_mission(game, (Mission_Code)game_state->current_mission) == ERROR)
+    return ERROR;
+  if (rng_set_state(game_get_rng(game), game_state->random) == ERROR)
+    return ERROR;
+
+  return OK;
+}
+
+Status snapshot_load_command(Snapshot *snapshot, Command *command, Command_state *state)
+{
+  char *argument = NULL, *argument2 = NULL;
+
+  if (!(argument = snapshot_string(snapshot, state->argument, ARG_LENGTH)) || !(argument2 = snapshot_string(snapshot, state->argument2, ARG_LENGTH)))
+    return ERROR;
+  if (state->code < NO_CMD || state->code >= NO_CMD + N_CMD)
+    return ERROR;
+
+  if (command_set_code(command, (CommandCode)state->code) == ERROR)
+    return ERROR;
+  command_set_argument(command, argument);
+  command_set_argument2(command, argument2);
+  return command_set_lastcmd_success(command, state->success == 1 ? OK : ERROR);
+}
+
+unsigned long snapshot_hash_string(unsigned long hash, const char *str)
+{
+  if (!str)
+    str = "";
+  return hash_bytes(hash, str, strlen(str) + 1);
+}
+
+unsigned long snapshot_hash_long(unsigned long hash, long value)
+{
+  return hash_bytes(hash, (const char *)&value, sizeof(long));
+}
@@ -9,6 +9,7 @@
  */
 
 #include "space.h"
+#include "string_pool.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -22,22 +23,31 @@
 struct _Space
 {
   Id id;                    /*!< Id number of the space, it must be unique */
-  char name[WORD_SIZE + 1]; /*!< Name of the space */
+  String_handle name;       /*!< Handle of the name of the space in the string pool */
   Set *objects;             /*!< The set of objects present at the space */
   Set *characters;          /*!< Set of the character present in the space */
-  char **gdesc;             /*!< The graphic description of the space */
+  Art *gdesc;               /*!< The graphic description of the space, shared with the spaces that have the same one */
   Bool discovered;          /*!< Boolean that describes if the space has been discovered by the players or not*/
+  Link *links[N_DIRECTIONS]; /*!< Link that leaves the space in each direction, indexed by Direction (NULL if there is none)*/
+  Location_index *locations; /*!< Index where the objects added to the space are recorded, NULL if there is none*/
+  Arena *arena;              /*!< Arena the space and its sets are allocated from, NULL if they are allocated on their own*/
 };
 
 Space *space_create(Id id)
+{
+  return space_create_in_arena(NULL, id);
+}
+
+Space *space_create_in_arena(Arena *arena, Id id)
 {
   Space *newSpace = NULL;
+  char *blank[N_TOTAL_ROWS_IN_SQUARE];
   int i;
   /* Error control */
   if (id == NO_ID)
     return NULL;
 
-  newSpace = (Space *)malloc(sizeof(Space));
+  newSpace = arena ? (Space *)arena_alloc(arena, sizeof(Space)) : (Space *)malloc(sizeof(Space));
   if (newSpace == NULL)
   {
     return NULL;
@@ -45,26 +55,67 @@ Space *space_create(Id id)
 
   /* Initialization of an empty space*/
   newSpace->id = id;
-  newSpace->name[0] = '\0';
-  newSpace->objects = set_create();
-  newSpace->characters = set_create();
+  newSpace->name = EMPTY_STRING;
+  newSpace->arena = arena;
+  newSpace->gdesc = NULL;
+  newSpace->objects = set_create_in_arena(arena);
+  newSpace->characters = set_create_in_arena(arena);
   newSpace->discovered = FALSE;
+  newSpace->locations = NULL;
+  for (i = 0; i < N_DIRECTIONS; i++)
+  {
+    newSpace->links[i] = NULL;
+  }
 
-  if (!(newSpace->gdesc = (char **)calloc(N_TOTAL_ROWS_IN_SQUARE, sizeof(char *))))
+  /*Every space starts with the same blank description, until one is set*/
+  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
+  {
+    blank[i] = NULL;
+  }
+  if (!(newSpace->gdesc = art_acquire(blank, N_TOTAL_ROWS_IN_SQUARE, N_TOTAL_COLUMNS_IN_SQUARE)))
   {
     space_destroy(newSpace);
     return NULL;
   }
-  if (!(newSpace->gdesc[0] = (char *)calloc((N_TOTAL_COLUMNS_IN_SQUARE)*N_TOTAL_ROWS_IN_SQUARE, sizeof(char))))
+  return newSpace;
+}
+
+Space *space_copy_in_arena(Arena *arena, Space *space)
+{
+  Space *copy = NULL;
+  int i;
+
+  if (!space)
+    return NULL;
+
+  if (!(copy = arena ? (Space *)arena_alloc(arena, sizeof(Space)) : (Space *)malloc(sizeof(Space))))
   {
-    space_destroy(newSpace);
     return NULL;
   }
-  for (i = 1; i < N_TOTAL_ROWS_IN_SQUARE; i++)
+
+  /*The name and the description never change, so the copy keeps the same ones*/
+  *copy = *space;
+  copy->arena = arena;
+  copy->gdesc = art_retain(space->gdesc);
+  copy->locations = NULL;
+  for (i = 0; i < N_DIRECTIONS; i++)
   {
-    newSpace->gdesc[i] = newSpace->gdesc[0] + (N_TOTAL_COLUMNS_IN_SQUARE)*i;
+    copy->links[i] = NULL;
   }
-  return newSpace;
+  copy->objects = set_copy_in_arena(arena, space->objects);
+  copy->characters = set_copy_in_arena(arena, space->characters);
+  if (!copy->objects || !copy->characters)
+  {
+    art_release(copy->gdesc);
+    if (!arena)
+    {
+      set_destroy(copy->objects);
+      set_destroy(copy->characters);
+      free(copy);
+    }
+    return NULL;
+  }
+  return copy;
 }
 
 Status space_destroy(Space *space)
@@ -73,13 +124,13 @@ Status space_destroy(Space *space)
   {
     return ERROR;
   }
-  if (space->gdesc)
+  /*The description is not in the arena, other spaces may still be using it*/
+  art_release(space->gdesc);
+  space->gdesc = NULL;
+  /*The memory of a space in an arena is released with the arena*/
+  if (space->arena)
   {
-    if (space->gdesc[0])
-    {
-      free(space->gdesc[0]);
-    }
-    free(space->gdesc);
+    return OK;
   }
   set_destroy(space->objects);
   set_destroy(space->characters);
@@ -107,15 +158,18 @@ Id space_get_id(Space *space)
 
 Status space_set_name(Space *space, char *name)
 {
+  String_handle handle;
+
   if (!space || !name)
   {
     return ERROR;
   }
 
-  if (!strcpy(space->name, name))
+  if ((handle = string_pool_intern(name)) == NO_STRING)
   {
     return ERROR;
   }
+  space->name = handle;
   return OK;
 }
 
@@ -125,7 +179,7 @@ const char *space_get_name(Space *space)
   {
     return NULL;
   }
-  return space->name;
+  return string_pool_get(space->name);
 }
 
 Status space_print(Space *space)
@@ -139,7 +193,7 @@ Status space_print(Space *space)
   }
 
   /* 1. Print the id and the name of the space */
-  fprintf(stdout, "--> Space (Id: %ld; Name: %s)\n", space->id, space->name);
+  fprintf(stdout, "--> Space (Id: %ld; Name: %s)\n", space->id, string_pool_get(space->name));
 
   if (set_is_empty(space->objects))
   {
@@ -168,7 +222,7 @@ Status space_print(Space *space)
   fprintf(stdout, "\nGraphic description of the space: ");
   for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
   {
-    printf("\n%s", space->gdesc[i]);
+    printf("\n%s", art_get_rows(space->gdesc)[i]);
   }
   fprintf(stdout, "\nDiscovered state of space: ");
   if (space->discovered == TRUE)
@@ -222,21 +276,29 @@ char **space_get_gdesc(Space *space)
 {
   if (!space)
     return NULL;
-  return space->gdesc;
+  return art_get_rows(space->gdesc);
 }
 
 Status space_set_gdesc(Space *space, char **space_gdescription)
 {
-  int i = 0;
-  if (!space)
+  Art *art = NULL;
+  if (!space || !space_gdescription)
     return ERROR;
-  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
-  {
-    if (!strcpy(space->gdesc[i], space_gdescription[i]))
-    {
-      return ERROR;
-    }
-  }
+  if (!(art = art_acquire(space_gdescription, N_TOTAL_ROWS_IN_SQUARE, N_TOTAL_COLUMNS_IN_SQUARE)))
+    return ERROR;
+  /*The old description is never modified, the space just stops using it*/
+  art_release(space->gdesc);
+  space->gdesc = art;
+  return OK;
+}
+
+Status space_share_gdesc(Space *space, Space *source)
+{
+  if (!space || !source || !source->gdesc)
+    return ERROR;
+  art_retain(source->gdesc);
+  art_release(space->gdesc);
+  space->gdesc = source->gdesc;
   return OK;
 }
 /*END OF GDESC RELATED FUNCTIONS*/
@@ -249,7 +311,13 @@ Status space_add_objectId(Space *space, Id object_Id)
   {
     return ERROR;
   }
-  return set_add(space->objects, object_Id);
+  if (set_add(space->objects, object_Id) == ERROR)
+  {
+    return ERROR;
+  }
+  /*The index is told that the object is now in this space*/
+  location_index_set(space->locations, object_Id, IN_SPACE, space->id);
+  return OK;
 }
 
 Bool space_object_belongs(Space *space, Id object_Id)
@@ -266,7 +334,11 @@ Status space_delete_object(Space *space, Id objectId)
   if (!space || !(space->objects) || objectId == NO_ID)
     return ERROR;
 
-  return set_del(space->objects, objectId);
+  if (set_del(space->objects, objectId) == ERROR)
+    return ERROR;
+
+  location_index_remove(space->locations, objectId, IN_SPACE, space->id);
+  return OK;
 }
 
 Bool space_has_no_objects(Space *space)
@@ -322,4 +394,38 @@ Bool space_get_discovered(Space *space)
     return FALSE;
 
   return space->discovered;
+}
+
+Status space_set_link(Space *space, Direction direction, Link *link)
+{
+  if (!space || direction < 0 || direction >= N_DIRECTIONS)
+  {
+    return ERROR;
+  }
+  space->links[direction] = link;
+  return OK;
+}
+
+Link *space_get_link(Space *space, Direction direction)
+{
+  if (!space || direction < 0 || direction >= N_DIRECTIONS)
+    return NULL;
+
+  return space->links[direction];
+}
+
+Status space_set_location_index(Space *space, Location_index *index)
+{
+  int i;
+
+  if (!space)
+  {
+    return ERROR;
+  }
+  space->locations = index;
+  for (i = 0; i < set_get_num_elements(space->objects); i++)
+  {
+    location_index_set(index, set_get_Id_in_pos(space->objects, i), IN_SPACE, space->id);
+  }
+  return OK;
 }
\ No newline at end of file
@@ -13,7 +13,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAX_TESTS 51         /*!<Total number of test functions*/
+#define MAX_TESTS 67         /*!<Total number of test functions*/
 #define SPACE_NAME "espacio" /*!<Name that will be given to the spaces created for the tests*/
 #define SPACE_ID 5           /*!<Id that will be given to the spaces created for the tests*/
 #define OBJECT_ID 3          /*!<Id that will be given to the objects created for the tests*/
@@ -21,6 +21,7 @@
 #define NO_ELEMENTS 0        /*!<Number of elements of an empty set/array*/
 #define ONE_ELEMENT 1        /*!<Size of a one-element set or array*/
 #define INVALID_VALUE -1     /*!<Value used to test correct handling of incorrect arguments for certain functions*/
+#define LINK_ID 6            /*!<Id that will be given to the links created for the tests*/
 
 /**
  * @brief Main function for SPACE unit tests.
@@ -157,6 +158,38 @@ int main(int argc, char **argv)
     test2_space_get_n_characters();
   if (all || test == 51)
     test3_space_get_n_characters();
+  if (all || test == 52)
+    test1_space_set_link();
+  if (all || test == 53)
+    test2_space_set_link();
+  if (all || test == 54)
+    test3_space_set_link();
+  if (all || test == 55)
+    test1_space_get_link();
+  if (all || test == 56)
+    test2_space_get_link();
+  if (all || test == 57)
+    test3_space_get_link();
+  if (all || test == 58)
+    test1_space_set_location_index();
+  if (all || test == 59)
+    test2_space_set_location_index();
+  if (all || test == 60)
+    test3_space_set_location_index();
+  if (all || test == 61)
+    test4_space_set_location_index();
+  if (all || test == 62)
+    test1_space_create_in_arena();
+  if (all || test == 63)
+    test1_space_set_gdesc();
+  if (all || test == 64)
+    test2_space_set_gdesc();
+  if (all || test == 65)
+    test3_space_set_gdesc();
+  if (all || test == 66)
+    test1_space_share_gdesc();
+  if (all || test == 67)
+    test1_space_copy_in_arena();
 
   PRINT_PASSED_PERCENTAGE;
 
@@ -455,7 +488,7 @@ void test2_space_set_of_objects_is_full()
   {
     space_add_objectId(s, (long)(i + 1));
   }
-  PRINT_TEST_RESULT(space_set_of_objects_is_full(s) == TRUE);
+  PRINT_TEST_RESULT(space_set_of_objects_is_full(s) == FALSE);
   space_destroy(s);
 }
 
@@ -570,4 +603,173 @@ void test3_space_get_n_characters()
   Space *s = space_create(SPACE_ID);
   PRINT_TEST_RESULT(space_get_n_characters(s) == NO_ELEMENTS);
   space_destroy(s);
-}
\ No newline at end of file
+}
+
+void test1_space_set_link()
+{
+  Space *s = space_create(SPACE_ID);
+  Link *l = link_create(LINK_ID);
+  PRINT_TEST_RESULT(space_set_link(s, N, l) == OK);
+  link_destroy(l);
+  space_destroy(s);
+}
+
+void test2_space_set_link()
+{
+  Space *s = NULL;
+  Link *l = link_create(LINK_ID);
+  PRINT_TEST_RESULT(space_set_link(s, N, l) == ERROR);
+  link_destroy(l);
+}
+
+void test3_space_set_link()
+{
+  Space *s = space_create(SPACE_ID);
+  Link *l = link_create(LINK_ID);
+  PRINT_TEST_RESULT(space_set_link(s, INVALID_VALUE, l) == ERROR);
+  link_destroy(l);
+  space_destroy(s);
+}
+
+void test1_space_get_link()
+{
+  Space *s = space_create(SPACE_ID);
+  Link *l = link_create(LINK_ID);
+  space_set_link(s, E, l);
+  PRINT_TEST_RESULT(space_get_link(s, E) == l);
+  link_destroy(l);
+  space_destroy(s);
+}
+
+void test2_space_get_link()
+{
+  Space *s = space_create(SPACE_ID);
+  PRINT_TEST_RESULT(space_get_link(s, E) == NULL);
+  space_destroy(s);
+}
+
+void test3_space_get_link()
+{
+  Space *s = NULL;
+  PRINT_TEST_RESULT(space_get_link(s, E) == NULL);
+}
+
+void test1_space_set_location_index()
+{
+  Space *s = space_create(SPACE_ID);
+  Location_index *index = location_index_create();
+  Id space_id = NO_ID;
+  space_add_objectId(s, OBJECT_ID);
+  PRINT_TEST_RESULT(space_set_location_index(s, index) == OK && location_index_get(index, OBJECT_ID, &space_id) == IN_SPACE && space_id == SPACE_ID);
+  space_destroy(s);
+  location_index_destroy(index);
+}
+
+void test2_space_set_location_index()
+{
+  Space *s = NULL;
+  Location_index *index = location_index_create();
+  PRINT_TEST_RESULT(space_set_location_index(s, index) == ERROR);
+  location_index_destroy(index);
+}
+
+void test3_space_set_location_index()
+{
+  Space *s = space_create(SPACE_ID);
+  Location_index *index = location_index_create();
+  Id space_id = NO_ID;
+  space_set_location_index(s, index);
+  space_add_objectId(s, OBJECT_ID);
+  PRINT_TEST_RESULT(location_index_get(index, OBJECT_ID, &space_id) == IN_SPACE && space_id == SPACE_ID);
+  space_destroy(s);
+  location_index_destroy(index);
+}
+
+void test4_space_set_location_index()
+{
+  Space *s = space_create(SPACE_ID);
+  Location_index *index = location_index_create();
+  Id space_id = NO_ID;
+  space_set_location_index(s, index);
+  space_add_objectId(s, OBJECT_ID);
+  space_delete_object(s, OBJECT_ID);
+  PRINT_TEST_RESULT(location_index_get(index, OBJECT_ID, &space_id) == NOWHERE && space_id == NO_ID);
+  space_destroy(s);
+  location_index_destroy(index);
+}
+
+void test1_space_create_in_arena()
+{
+  Arena *arena = arena_create();
+  Space *s;
+  s = space_create_in_arena(arena, SPACE_ID);
+  space_add_objectId(s, OBJECT_ID);
+  PRINT_TEST_RESULT(s != NULL && space_get_id(s) == SPACE_ID && space_object_belongs(s, OBJECT_ID) == TRUE && space_destroy(s) == OK);
+  arena_destroy(arena);
+}
+
+void test1_space_set_gdesc()
+{
+  Space *s1 = space_create(SPACE_ID), *s2 = space_create(SPACE_ID + 1);
+  char *gdesc[N_TOTAL_ROWS_IN_SQUARE];
+  char row[N_TOTAL_COLUMNS_IN_SQUARE] = "+--+";
+  int i;
+  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
+    gdesc[i] = row;
+  space_set_gdesc(s1, gdesc);
+  strcpy(row, "|  |");
+  PRINT_TEST_RESULT(space_set_gdesc(s2, gdesc) == OK && strcmp(space_get_gdesc(s1)[0], "+--+") == 0 && strcmp(space_get_gdesc(s2)[N_TOTAL_ROWS_IN_SQUARE - 1], "|  |") == 0);
+  space_destroy(s1);
+  space_destroy(s2);
+}
+
+void test2_space_set_gdesc()
+{
+  Space *s1 = space_create(SPACE_ID), *s2 = space_create(SPACE_ID + 1);
+  char *gdesc[N_TOTAL_ROWS_IN_SQUARE];
+  char row[N_TOTAL_COLUMNS_IN_SQUARE] = "+--+";
+  int i;
+  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
+    gdesc[i] = row;
+  space_set_gdesc(s1, gdesc);
+  space_set_gdesc(s2, gdesc);
+  PRINT_TEST_RESULT(space_get_gdesc(s1) == space_get_gdesc(s2));
+  space_destroy(s1);
+  space_destroy(s2);
+}
+
+void test3_space_set_gdesc()
+{
+  Space *s = space_create(SPACE_ID);
+  PRINT_TEST_RESULT(space_set_gdesc(NULL, space_get_gdesc(s)) == ERROR && space_set_gdesc(s, NULL) == ERROR);
+  space_destroy(s);
+}
+
+void test1_space_share_gdesc()
+{
+  Space *s1 = space_create(SPACE_ID), *s2 = space_create(SPACE_ID + 1);
+  char *gdesc[N_TOTAL_ROWS_IN_SQUARE];
+  int i;
+  for (i = 0; i < N_TOTAL_ROWS_IN_SQUARE; i++)
+    gdesc[i] = "+--+";
+  space_set_gdesc(s1, gdesc);
+  space_share_gdesc(s2, s1);
+  space_destroy(s1);
+  PRINT_TEST_RESULT(strcmp(space_get_gdesc(s2)[0], "+--+") == 0);
+  space_destroy(s2);
+}
+
+void test1_space_copy_in_arena()
+{
+  Arena *arena = arena_create();
+  Space *s = space_create(SPACE_ID), *copy = NULL;
+  space_set_name(s, SPACE_NAME);
+  space_add_objectId(s, OBJECT_ID);
+  space_set_discovered(s, TRUE);
+  copy = space_copy_in_arena(arena, s);
+  space_delete_object(s, OBJECT_ID);
+  PRINT_TEST_RESULT(copy != NULL && space_get_id(copy) == SPACE_ID && strcmp(space_get_name(copy), SPACE_NAME) == 0 && space_object_belongs(copy, OBJECT_ID) == TRUE && space_get_discovered(copy) == TRUE && space_get_gdesc(copy) == space_get_gdesc(s));
+  space_destroy(s);
+  space_destroy(copy);
+  arena_destroy(arena);
+}
@@ -0,0 +1,179 @@
+/**
+ * @brief It implements the pool where the texts of the entities are interned
+ *
+ * @file string_pool.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "string_pool.h"
+#include "arena.h"
+#include "hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define INITIAL_STRINGS 64      /*!<Number of strings the pool has room for when it is first used, a power of two*/
+
+/**
+ * @brief Strings of the pool and the table to find them
+ * @author agent
+ */
+typedef struct
+{
+  Arena *texts;   /*!<Arena the strings are copied to, so they never move*/
+  char **strings; /*!<Text of each handle*/
+  int n_strings;  /*!<Number of strings in the pool*/
+  int *slots;     /*!<Open addressing table with the handle of each string plus one, 0 in the empty slots*/
+  int n_slots;    /*!<Number of slots, a power of two at least twice the number of strings*/
+} String_pool;
+
+static String_pool pool = {NULL, NULL, 0, NULL, 0}; /*!<The pool shared by all the games of the process*/
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER; /*!<Lock of the pool, the games using it can run in different threads*/
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the handle of a string, adding it to the pool if it is not there yet, with the lock of the pool already taken
+ * @author agent
+ * @param str the string
+ * @return the handle of the string, or NO_STRING if there is no memory to add it
+ */
+String_handle string_pool_add(const char *str);
+
+/**
+ * @brief Gets the slot where a string is stored, or the empty slot where it would be stored
+ * @author agent
+ * @param slots the slots of the table
+ * @param n_slots the number of slots
+ * @param str the string
+ * @return the position of the slot
+ */
+int string_pool_slot(int *slots, int n_slots, const char *str);
+
+/**
+ * @brief Doubles the room for strings of the pool, allocating it the first time
+ * @author agent
+ * @return Status OK or ERROR
+ */
+Status string_pool_grow();
+
+/****************************/
+/* Functions implementation */
+/****************************/
+String_handle string_pool_intern(const char *str)
+{
+  String_handle handle;
+
+  if (!str)
+    str = "";
+
+  pthread_mutex_lock(&pool_lock);
+  handle = string_pool_add(str);
+  pthread_mutex_unlock(&pool_lock);
+  return handle;
+}
+
+const char *string_pool_get(String_handle handle)
+{
+  const char *str = "";
+
+  /*The table of strings moves when the pool grows, but the texts stay where they are, so they can be used after unlocking*/
+  pthread_mutex_lock(&pool_lock);
+  if (handle >= 0 && handle < pool.n_strings)
+    str = pool.strings[handle];
+  pthread_mutex_unlock(&pool_lock);
+  return str;
+}
+
+void string_pool_release()
+{
+  pthread_mutex_lock(&pool_lock);
+  arena_destroy(pool.texts);
+  free(pool.strings);
+  free(pool.slots);
+  pool.texts = NULL;
+  pool.strings = NULL;
+  pool.n_strings = 0;
+  pool.slots = NULL;
+  pool.n_slots = 0;
+  pthread_mutex_unlock(&pool_lock);
+}
+
+String_handle string_pool_add(const char *str)
+{
+  char *copy = NULL;
+  int slot;
+  size_t length;
+
+  /*The first string interned is always the empty one, so it gets EMPTY_STRING*/
+  if (!pool.texts && (string_pool_grow() == ERROR || string_pool_add("") != EMPTY_STRING))
+    return NO_STRING;
+
+  slot = string_pool_slot(pool.slots, pool.n_slots, str);
+  if (pool.slots[slot] != 0)
+    return pool.slots[slot] - 1;
+
+  if (2 * (pool.n_strings + 1) > pool.n_slots)
+  {
+    if (string_pool_grow() == ERROR)
+      return NO_STRING;
+    slot = string_pool_slot(pool.slots, pool.n_slots, str);
+  }
+
+  length = strlen(str);
+  if (!(copy = (char *)arena_alloc(pool.texts, length + 1)))
+    return NO_STRING;
+  memcpy(copy, str, length + 1);
+
+  pool.strings[pool.n_strings] = copy;
+  pool.n_strings++;
+  pool.slots[slot] = pool.n_strings;
+
+  return pool.n_strings - 1;
+}
+
+int string_pool_slot(int *slots, int n_slots, const char *str)
+{
+  int slot;
+
+  slot = (int)(hash_bytes(HASH_START, str, (long)strlen(str)) & (n_slots - 1));
+
+  /*Linear probing, the table always has empty slots so the search stops*/
+  while (slots[slot] != 0 && strcmp(pool.strings[slots[slot] - 1], str) != 0)
+  {
+    slot = (slot + 1) & (n_slots - 1);
+  }
+
+  return slot;
+}
+
+Status string_pool_grow()
+{
+  char **strings = NULL;
+  int *slots = NULL;
+  int i, n_slots = pool.n_slots ? 2 * pool.n_slots : 2 * INITIAL_STRINGS;
+
+  if (!pool.texts && !(pool.texts = arena_create()))
+    return ERROR;
+
+  if (!(strings = (char **)realloc(pool.strings, (n_slots / 2) * sizeof(char *))))
+    return ERROR;
+  pool.strings = strings;
+
+  if (!(slots = (int *)calloc(n_slots, sizeof(int))))
+    return ERROR;
+  for (i = 0; i < pool.n_strings; i++)
+    slots[string_pool_slot(slots, n_slots, pool.strings[i])] = i + 1;
+
+  free(pool.slots);
+  pool.slots = slots;
+  pool.n_slots = n_slots;
+  return OK;
+}
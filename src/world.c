@@ -0,0 +1,834 @@
+/**
+ * @brief It implements the compiled world images
+ *
+ * @file world.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "world.h"
+#include "glyph.h"
+#include "hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define WORLD_MAGIC "WORLDIMG"       /*!<First bytes of every world image*/
+#define WORLD_MAGIC_SIZE 8           /*!<Number of bytes of the magic, without the '\0'*/
+#define WORLD_BYTE_ORDER 0x01020304L /*!<Value written in the header to detect images compiled with another byte order*/
+#define POOL_CHUNK 4096              /*!<Number of bytes the string pool grows each time it is full*/
+
+/**
+ * @brief Tables of the image, in the order they are written
+ * @author agent
+ */
+typedef enum
+{
+  SPACE_TABLE,     /*!<Space_record for each space*/
+  OBJECT_TABLE,    /*!<Object_record for each object*/
+  PLAYER_TABLE,    /*!<Player_record for each player*/
+  CHARACTER_TABLE, /*!<Character_record for each character*/
+  LINK_TABLE,      /*!<Link_record for each link*/
+  CINEMATIC_TABLE, /*!<Cinematic_record for each line of the cinematics*/
+  MISSION_TABLE,   /*!<Mission_record for each mission*/
+  ID_TABLE,        /*!<Ids of the objects in the backpacks of the players*/
+  STRING_TABLE,    /*!<Pool offsets of the messages of the characters and the objectives and dialogues of the missions*/
+  N_TABLES         /*!<Number of tables*/
+} World_table_type;
+
+/**
+ * @brief Position of a table in the image
+ * @author agent
+ */
+typedef struct
+{
+  long offset; /*!<Byte of the image where the table starts*/
+  long count;  /*!<Number of records of the table*/
+} World_table;
+
+/**
+ * @brief Header at the start of every image
+ * @author agent
+ */
+typedef struct
+{
+  char magic[WORLD_MAGIC_SIZE]; /*!<WORLD_MAGIC*/
+  long version;                 /*!<WORLD_VERSION of the compiler*/
+  long byte_order;              /*!<WORLD_BYTE_ORDER, as written by the compiler*/
+  long long_size;               /*!<Size of long for the compiler*/
+  long size;                    /*!<Size of the whole image*/
+  unsigned long checksum;       /*!<Checksum of every byte after the header*/
+  long current_cinematic;       /*!<Cinematic the world starts with*/
+  World_table tables[N_TABLES]; /*!<Tables of records*/
+  long pool_offset;             /*!<Byte of the image where the string pool starts*/
+  long pool_size;               /*!<Size of the string pool*/
+} World_header;
+
+/**
+ * @brief Record of a space, the strings are offsets in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long id;                           /*!<Id of the space*/
+  long name;                         /*!<Name of the space*/
+  long discovered;                   /*!<1 if the space is discovered*/
+  long gdesc[N_TOTAL_ROWS_IN_SQUARE]; /*!<Rows of the graphic description*/
+} Space_record;
+
+/**
+ * @brief Record of an object, the strings are offsets in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long id;          /*!<Id of the object*/
+  long name;        /*!<Name of the object*/
+  long gdesc;       /*!<Graphic description, already decoded*/
+  long description; /*!<Description of the object*/
+  long location;    /*!<Space where the object is, NO_ID if it is not in one*/
+  long movable;     /*!<1 if the object can be taken*/
+  long health;      /*!<Health the object gives*/
+  long dependency;  /*!<Object it depends on*/
+  long open;        /*!<Link the object opens*/
+} Object_record;
+
+/**
+ * @brief Record of a player, the strings are offsets in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long id;           /*!<Id of the player*/
+  long name;         /*!<Name of the player*/
+  long gdesc;        /*!<Graphic description, already decoded*/
+  long location;     /*!<Space where the player is*/
+  long health;       /*!<Health of the player*/
+  long max_objects;  /*!<Size of the backpack*/
+  long team;         /*!<Team of the player*/
+  long first_object; /*!<Position in the ID table of the first object of the backpack*/
+  long n_objects;    /*!<Number of objects in the backpack*/
+} Player_record;
+
+/**
+ * @brief Record of a character, the strings are offsets in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long id;            /*!<Id of the character*/
+  long name;          /*!<Name of the character*/
+  long gdesc;         /*!<Graphic description, already decoded*/
+  long dead_gdesc;    /*!<Graphic description once dead, already decoded*/
+  long location;      /*!<Space where the character is*/
+  long health;        /*!<Health of the character*/
+  long friendly;      /*!<1 if the character is friendly*/
+  long following;     /*!<Player the character follows*/
+  long first_message; /*!<Position in the STRING table of the first message*/
+  long n_messages;    /*!<Number of messages*/
+} Character_record;
+
+/**
+ * @brief Record of a link, the name is an offset in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long id;          /*!<Id of the link*/
+  long name;        /*!<Name of the link*/
+  long origin;      /*!<Space the link starts in*/
+  long destination; /*!<Space the link goes to*/
+  long direction;   /*!<Direction of the link*/
+  long open;        /*!<1 if the link is open*/
+} Link_record;
+
+/**
+ * @brief Record of a line of a cinematic, the text is an offset in the pool
+ * @author agent
+ */
+typedef struct
+{
+  long cinematic; /*!<Cinematic the line belongs to*/
+  long text;      /*!<Text of the line*/
+} Cinematic_record;
+
+/**
+ * @brief Record of a mission
+ * @author agent
+ */
+typedef struct
+{
+  long code;            /*!<Code of the mission*/
+  long current_step;    /*!<Step the mission is in*/
+  long next_objective;  /*!<Index of the next objective*/
+  long first_objective; /*!<Position in the STRING table of the first objective*/
+  long n_objectives;    /*!<Number of objectives*/
+  long next_dialogue;   /*!<Index of the next dialogue*/
+  long first_dialogue;  /*!<Position in the STRING table of the first dialogue*/
+  long n_dialogues;     /*!<Number of dialogues*/
+} Mission_record;
+
+/**
+ * @brief Image being compiled or loaded
+ * @author agent
+ */
+typedef struct
+{
+  char *data;           /*!<Header and tables of the image (the whole image once loaded)*/
+  World_header *header; /*!<Header, at the start of data*/
+  char *pool;           /*!<String pool*/
+  long pool_size;       /*!<Bytes used in the pool*/
+  long pool_cap;        /*!<Bytes allocated for the pool while compiling*/
+  long n_ids;           /*!<Entries of the ID table filled while compiling*/
+  long n_strings;       /*!<Entries of the STRING table filled while compiling*/
+  Status status;        /*!<ERROR once something has failed while compiling*/
+} World_image;
+
+static size_t record_size[N_TABLES] = {sizeof(Space_record), sizeof(Object_record), sizeof(Player_record), sizeof(Character_record), sizeof(Link_record), sizeof(Cinematic_record), sizeof(Mission_record), sizeof(long), sizeof(long)}; /*!<Size of the records of each table*/
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets a record of a table of the image
+ * @author agent
+ * @param image the image
+ * @param table the table
+ * @param pos position of the record in the table
+ * @return a pointer to the record
+ */
+void *world_record(World_image *image, World_table_type table, long pos);
+
+/**
+ * @brief Copies a string to the pool of an image being compiled
+ * @author agent
+ * @param image the image
+ * @param str the string
+ * @return the offset of the string in the pool
+ */
+long world_add_string(World_image *image, const char *str);
+
+/**
+ * @brief Copies a decoded graphic description to the pool of an image being compiled
+ * @author agent
+ *
+ * The setters decode the graphic descriptions they receive, so the description is stored encoded and
+ *  decoding it again gives back the same one.
+ * @param image the image
+ * @param gdesc the decoded graphic description
+ * @return the offset of the description in the pool
+ */
+long world_add_art(World_image *image, const char *gdesc);
+
+/**
+ * @brief Adds a string to the STRING table of an image being compiled
+ * @author agent
+ * @param image the image
+ * @param str the string
+ * @return the position of the string in the table
+ */
+long world_add_table_string(World_image *image, const char *str);
+
+/**
+ * @brief Fills the tables of an image being compiled with the entities of a game
+ * @author agent
+ * @param image the image, with its tables already allocated
+ * @param game the game
+ */
+void world_compile_tables(World_image *image, Game *game);
+
+/**
+ * @brief Checks that a mapped image is valid, so its records can be trusted
+ * @author agent
+ * @param image the image
+ * @param size the size of the file
+ * @return Status OK or ERROR
+ */
+Status world_check(World_image *image, long size);
+
+/**
+ * @brief Gets a string of the pool of a loaded image
+ * @author agent
+ * @param image the image
+ * @param offset the offset of the string
+ * @return the string, or NULL if the offset is outside the pool
+ */
+char *world_string(World_image *image, long offset);
+
+/**
+ * @brief Gets a string of the STRING table of a loaded image
+ * @author agent
+ * @param image the image
+ * @param pos the position of the string in the table
+ * @return the string, or NULL if the position is outside the table
+ */
+char *world_table_string(World_image *image, long pos);
+
+/**
+ * @brief Creates the entities of a loaded image and adds them to a game
+ * @author agent
+ * @param image the image, already checked
+ * @param game the game
+ * @return Status OK or ERROR
+ */
+Status world_load_tables(World_image *image, Game *game);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+Bool world_is_image(char *filename)
+{
+  FILE *file = NULL;
+  char magic[WORLD_MAGIC_SIZE];
+  Bool is_image = FALSE;
+
+  if (!filename || !(file = fopen(filename, "rb")))
+    return FALSE;
+
+  if (fread(magic, 1, WORLD_MAGIC_SIZE, file) == WORLD_MAGIC_SIZE && memcmp(magic, WORLD_MAGIC, WORLD_MAGIC_SIZE) == 0)
+    is_image = TRUE;
+
+  fclose(file);
+  return is_image;
+}
+
+Status world_compile(Game *game, char *filename)
+{
+  World_image image;
+  FILE *file = NULL;
+  Player *player = NULL;
+  Character *character = NULL;
+  Mission *mission = NULL;
+  long counts[N_TABLES];
+  long size;
+  int i;
+
+  if (!game || !filename)
+    return ERROR;
+
+  counts[SPACE_TABLE] = game_get_n_spaces(game);
+  counts[OBJECT_TABLE] = game_get_n_objects(game);
+  counts[PLAYER_TABLE] = game_get_n_players(game);
+  counts[CHARACTER_TABLE] = game_get_n_characters(game);
+  counts[LINK_TABLE] = game_get_n_links(game);
+  counts[MISSION_TABLE] = game_get_n_missions(game);
+  counts[CINEMATIC_TABLE] = counts[ID_TABLE] = counts[STRING_TABLE] = 0;
+  for (i = 0; i < N_CINEMATICS; i++)
+    counts[CINEMATIC_TABLE] += cinematics_get_n_lines(game_get_cinematic_text_in_pos(game, i));
+  for (i = 0; i < counts[PLAYER_TABLE]; i++)
+  {
+    player = game_get_player_in_pos(game, i);
+    counts[ID_TABLE] += player_get_num_objects_in_backpack(player);
+  }
+  for (i = 0; i < counts[CHARACTER_TABLE]; i++)
+  {
+    character = game_get_character_in_pos(game, i);
+    counts[STRING_TABLE] += character_get_n_messages(character);
+  }
+  for (i = 0; i < counts[MISSION_TABLE]; i++)
+  {
+    mission = game_get_mission_in_pos(game, i);
+    counts[STRING_TABLE] += mission_get_n_objectives(mission) + mission_get_n_dialogues(mission);
+  }
+
+  /*The header and the tables are allocated at once, the pool grows as the strings are added*/
+  size = sizeof(World_header);
+  for (i = 0; i < N_TABLES; i++)
+    size += counts[i] * record_size[i];
+
+  memset(&image, 0, sizeof(World_image));
+  image.status = OK;
+  if (!(image.data = (char *)calloc(1, size)))
+    return ERROR;
+  image.header = (World_header *)image.data;
+
+  memcpy(image.header->magic, WORLD_MAGIC, WORLD_MAGIC_SIZE);
+  image.header->version = WORLD_VERSION;
+  image.header->byte_order = WORLD_BYTE_ORDER;
+  image.header->long_size = sizeof(long);
+  image.header->current_cinematic = game_get_current_cinematic(game);
+  image.header->tables[0].offset = sizeof(World_header);
+  for (i = 0; i < N_TABLES; i++)
+  {
+    if (i > 0)
+      image.header->tables[i].offset = image.header->tables[i - 1].offset + image.header->tables[i - 1].count * record_size[i - 1];
+    image.header->tables[i].count = counts[i];
+  }
+
+  world_compile_tables(&image, game);
+
+  if (image.status == OK)
+  {
+    image.header->pool_offset = size;
+    image.header->pool_size = image.pool_size;
+    image.header->size = size + image.pool_size;
+    image.header->checksum = hash_bytes(hash_bytes(HASH_START, image.data + sizeof(World_header), size - sizeof(World_header)), image.pool, image.pool_size);
+
+    if (!(file = fopen(filename, "wb")))
+    {
+      image.status = ERROR;
+    }
+    else
+    {
+      if (fwrite(image.data, 1, size, file) != (size_t)size || fwrite(image.pool, 1, image.pool_size, file) != (size_t)image.pool_size)
+        image.status = ERROR;
+      if (fclose(file) != 0)
+        image.status = ERROR;
+    }
+  }
+
+  free(image.pool);
+  free(image.data);
+  return image.status;
+}
+
+Status world_load(Game *game, char *filename)
+{
+  World_image image;
+  struct stat info;
+  Status status = ERROR;
+  int fd;
+
+  if (!game || !filename)
+    return ERROR;
+
+  if ((fd = open(filename, O_RDONLY)) == -1)
+    return ERROR;
+
+  if (fstat(fd, &info) == -1 || info.st_size < (off_t)sizeof(World_header))
+  {
+    close(fd);
+    return ERROR;
+  }
+
+  memset(&image, 0, sizeof(World_image));
+  image.data = (char *)mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (image.data == MAP_FAILED)
+    return ERROR;
+  image.header = (World_header *)image.data;
+
+  if (world_check(&image, (long)info.st_size) == OK)
+    status = world_load_tables(&image, game);
+
+  munmap(image.data, info.st_size);
+  return status;
+}
+
+void *world_record(World_image *image, World_table_type table, long pos)
+{
+  return image->data + image->header->tables[table].offset + pos * record_size[table];
+}
+
+long world_add_string(World_image *image, const char *str)
+{
+  char *pool = NULL;
+  long len, offset;
+
+  if (!str || image->status == ERROR)
+  {
+    image->status = ERROR;
+    return 0;
+  }
+
+  len = strlen(str) + 1;
+  if (image->pool_size + len > image->pool_cap)
+  {
+    if (!(pool = (char *)realloc(image->pool, image->pool_cap + len + POOL_CHUNK)))
+    {
+      image->status = ERROR;
+      return 0;
+    }
+    image->pool = pool;
+    image->pool_cap += len + POOL_CHUNK;
+  }
+
+  offset = image->pool_size;
+  memcpy(image->pool + offset, str, len);
+  image->pool_size += len;
+  return offset;
+}
+
+long world_add_art(World_image *image, const char *gdesc)
+{
+  char encoded[GDESCTAM * GLYPH_ESCAPE_SIZE];
+
+  if (!gdesc)
+    return world_add_string(image, gdesc);
+
+  glyph_encode(encoded, gdesc, GDESCTAM * GLYPH_ESCAPE_SIZE);
+  return world_add_string(image, encoded);
+}
+
+long world_add_table_string(World_image *image, const char *str)
+{
+  long *strings = (long *)world_record(image, STRING_TABLE, image->n_strings);
+
+  *strings = world_add_string(image, str);
+  return image->n_strings++;
+}
+
+void world_compile_tables(World_image *image, Game *game)
+{
+  Space_record *space_record = NULL;
+  Object_record *object_record = NULL;
+  Player_record *player_record = NULL;
+  Character_record *character_record = NULL;
+  Link_record *link_record = NULL;
+  Cinematic_record *cinematic_record = NULL;
+  Mission_record *mission_record = NULL;
+  Space *space = NULL;
+  Object *object = NULL;
+  Player *player = NULL;
+  Character *character = NULL;
+  Link *link = NULL;
+  Mission *mission = NULL;
+  Cinematics_text *cinematic = NULL;
+  long n_lines = 0;
+  int i, j;
+
+  for (i = 0; i < game_get_n_spaces(game); i++)
+  {
+    space = game_get_space_in_pos(game, i);
+    space_record = (Space_record *)world_record(image, SPACE_TABLE, i);
+    space_record->id = space_get_id(space);
+    space_record->name = world_add_string(image, space_get_name(space));
+    space_record->discovered = space_get_discovered(space) == TRUE ? 1 : 0;
+    for (j = 0; j < N_TOTAL_ROWS_IN_SQUARE; j++)
+      space_record->gdesc[j] = world_add_string(image, space_get_gdesc(space)[j]);
+  }
+
+  for (i = 0; i < game_get_n_objects(game); i++)
+  {
+    object = game_get_object_in_pos(game, i);
+    object_record = (Object_record *)world_record(image, OBJECT_TABLE, i);
+    object_record->id = object_get_id(object);
+    object_record->name = world_add_string(image, object_get_name(object));
+    object_record->gdesc = world_add_art(image, object_get_gdesc(object));
+    object_record->description = world_add_string(image, object_get_description(object));
+    object_record->location = game_get_object_location(game, object_get_id(object));
+    object_record->movable = object_get_movable(object) == TRUE ? 1 : 0;
+    object_record->health = object_get_health(object);
+    object_record->dependency = object_get_dependency(object);
+    object_record->open = object_get_open(object);
+  }
+
+  for (i = 0; i < game_get_n_players(game); i++)
+  {
+    player = game_get_player_in_pos(game, i);
+    player_record = (Player_record *)world_record(image, PLAYER_TABLE, i);
+    player_record->id = player_get_id(player);
+    player_record->name = world_add_string(image, player_get_name(player));
+    player_record->gdesc = world_add_art(image, player_get_gdesc(player));
+    player_record->location = player_get_location(player);
+    player_record->health = player_get_health(player);
+    player_record->max_objects = inventory_get_max_objs(player_get_inventory(player));
+    player_record->team = player_get_team(player);
+    player_record->first_object = image->n_ids;
+    player_record->n_objects = player_get_num_objects_in_backpack(player);
+    for (j = 0; j < player_record->n_objects; j++)
+      *(long *)world_record(image, ID_TABLE, image->n_ids++) = player_get_backpack_object_id_at(player, j);
+  }
+
+  for (i = 0; i < game_get_n_characters(game); i++)
+  {
+    character = game_get_character_in_pos(game, i);
+    character_record = (Character_record *)world_record(image, CHARACTER_TABLE, i);
+    character_record->id = character_get_id(character);
+    character_record->name = world_add_string(image, character_get_name(character));
+    character_record->gdesc = world_add_art(image, character_get_gdesc(character));
+    character_record->dead_gdesc = world_add_art(image, character_get_dead_gdesc(character));
+    character_record->location = character_get_location(character);
+    character_record->health = character_get_health(character);
+    character_record->friendly = character_get_friendly(character);
+    character_record->following = character_get_following(character);
+    character_record->first_message = image->n_strings;
+    character_record->n_messages = character_get_n_messages(character);
+    for (j = 0; j < character_record->n_messages; j++)
+      world_add_table_string(image, character_get_message_in_pos(character, j));
+  }
+
+  for (i = 0; i < game_get_n_links(game); i++)
+  {
+    link = game_get_link_in_pos(game, i);
+    link_record = (Link_record *)world_record(image, LINK_TABLE, i);
+    link_record->id = link_get_id(link);
+    link_record->name = world_add_string(image, link_get_name(link));
+    link_record->origin = link_get_origin_id(link);
+    link_record->destination = link_get_destination_id(link);
+    link_record->direction = link_get_direction(link);
+    link_record->open = link_get_is_open(link);
+  }
+
+  for (i = 0; i < N_CINEMATICS; i++)
+  {
+    cinematic = game_get_cinematic_text_in_pos(game, i);
+    for (j = 0; j < cinematics_get_n_lines(cinematic); j++)
+    {
+      cinematic_record = (Cinematic_record *)world_record(image, CINEMATIC_TABLE, n_lines++);
+      cinematic_record->cinematic = i;
+      cinematic_record->text = world_add_string(image, cinematics_get_line(cinematic, j));
+    }
+  }
+
+  for (i = 0; i < game_get_n_missions(game); i++)
+  {
+    mission = game_get_mission_in_pos(game, i);
+    mission_record = (Mission_record *)world_record(image, MISSION_TABLE, i);
+    mission_record->code = mission_get_code(mission);
+    mission_record->current_step = mission_get_current_step(mission);
+    mission_record->next_objective = mission_get_next_objective_index(mission);
+    mission_record->first_objective = image->n_strings;
+    mission_record->n_objectives = mission_get_n_objectives(mission);
+    for (j = 0; j < mission_record->n_objectives; j++)
+      world_add_table_string(image, mission_get_objective_in_pos(mission, j));
+    mission_record->next_dialogue = mission_get_next_dialogue_index(mission);
+    mission_record->first_dialogue = image->n_strings;
+    mission_record->n_dialogues = mission_get_n_dialogues(mission);
+    for (j = 0; j < mission_record->n_dialogues; j++)
+      world_add_table_string(image, mission_get_dialogue_in_pos(mission, j));
+  }
+}
+
+Status world_check(World_image *image, long size)
+{
+  World_header *header = image->header;
+  long end = sizeof(World_header);
+  int i;
+
+  if (memcmp(header->magic, WORLD_MAGIC, WORLD_MAGIC_SIZE) != 0 || header->version != WORLD_VERSION || header->long_size != (long)sizeof(long) || header->byte_order != WORLD_BYTE_ORDER || header->size != size)
+    return ERROR;
+
+  /*The tables must follow each other inside the image, with the pool at the end*/
+  for (i = 0; i < N_TABLES; i++)
+  {
+    if (header->tables[i].offset != end || header->tables[i].count < 0 || header->tables[i].count > (size - end) / (long)record_size[i])
+      return ERROR;
+    end += header->tables[i].count * record_size[i];
+  }
+  if (header->pool_offset != end || header->pool_size != size - end)
+    return ERROR;
+
+  image->pool = image->data + header->pool_offset;
+  image->pool_size = header->pool_size;
+  /*Every string ends before the end of the pool*/
+  if (image->pool_size > 0 && image->pool[image->pool_size - 1] != '\0')
+    return ERROR;
+
+  if (hash_bytes(HASH_START, image->data + sizeof(World_header), size - sizeof(World_header)) != header->checksum)
+    return ERROR;
+
+  return OK;
+}
+
+char *world_string(World_image *image, long offset)
+{
+  if (offset < 0 || offset >= image->pool_size)
+    return NULL;
+
+  return image->pool + offset;
+}
+
+char *world_table_string(World_image *image, long pos)
+{
+  if (pos < 0 || pos >= image->header->tables[STRING_TABLE].count)
+    return NULL;
+
+  return world_string(image, *(long *)world_record(image, STRING_TABLE, pos));
+}
+
+Status world_load_tables(World_image *image, Game *game)
+{
+  Space_record *space_record = NULL;
+  Object_record *object_record = NULL;
+  Player_record *player_record = NULL;
+  Character_record *character_record = NULL;
+  Link_record *link_record = NULL;
+  Cinematic_record *cinematic_record = NULL;
+  Mission_record *mission_record = NULL;
+  World_table *tables = image->header->tables;
+  char *gdesc[N_TOTAL_ROWS_IN_SQUARE];
+  Space *space = NULL;
+  Object *object = NULL;
+  Player *player = NULL;
+  Character *character = NULL;
+  Link *link = NULL;
+  Mission *mission = NULL;
+  long i, j;
+
+  /*The image tells how many entities there are, so the tables of the game are made the right size at once*/
+  if (game_reserve(game, (int)tables[SPACE_TABLE].count, (int)tables[OBJECT_TABLE].count, (int)tables[CHARACTER_TABLE].count, (int)tables[LINK_TABLE].count, (int)tables[MISSION_TABLE].count) == ERROR)
+    return ERROR;
+
+  /*The strings are passed straight from the mapping, the setters copy them*/
+  for (i = 0; i < tables[SPACE_TABLE].count; i++)
+  {
+    space_record = (Space_record *)world_record(image, SPACE_TABLE, i);
+    for (j = 0; j < N_TOTAL_ROWS_IN_SQUARE; j++)
+    {
+      if (!(gdesc[j] = world_string(image, space_record->gdesc[j])))
+        return ERROR;
+    }
+    if (!world_string(image, space_record->name) || !(space = space_create_in_arena(game_get_arena(game), space_record->id)))
+      return ERROR;
+    space_set_name(space, world_string(image, space_record->name));
+    space_set_gdesc(space, gdesc);
+    space_set_discovered(space, space_record->discovered == 1 ? TRUE : FALSE);
+    if (game_add_space(game, space) == ERROR)
+    {
+      space_destroy(space);
+      return ERROR;
+    }
+  }
+
+  for (i = 0; i < tables[OBJECT_TABLE].count; i++)
+  {
+    object_record = (Object_record *)world_record(image, OBJECT_TABLE, i);
+    if (!world_string(image, object_record->name) || !world_string(image, object_record->gdesc) || !world_string(image, object_record->description) || !(object = object_create_in_arena(game_get_arena(game), object_record->id)))
+      return ERROR;
+    object_set_name(object, world_string(image, object_record->name));
+    object_set_gdesc(object, world_string(image, object_record->gdesc));
+    object_set_description(object, world_string(image, object_record->description));
+    object_set_movable(object, object_record->movable == 1 ? TRUE : FALSE);
+    object_set_health(object, (int)object_record->health);
+    object_set_dependency(object, object_record->dependency);
+    object_set_open(object, object_record->open);
+    if (game_add_object(game, object) == ERROR)
+    {
+      object_destroy(object);
+      return ERROR;
+    }
+  }
+
+  for (i = 0; i < tables[PLAYER_TABLE].count; i++)
+  {
+    player_record = (Player_record *)world_record(image, PLAYER_TABLE, i);
+    if (!world_string(image, player_record->name) || !world_string(image, player_record->gdesc) || player_record->first_object < 0 || player_record->n_objects < 0 || player_record->first_object + player_record->n_objects > tables[ID_TABLE].count)
+      return ERROR;
+    if (!(player = player_create(player_record->id, (int)player_record->max_objects)))
+      return ERROR;
+    player_set_name(player, world_string(image, player_record->name));
+    player_set_gdesc(player, world_string(image, player_record->gdesc));
+    player_set_location(player, player_record->location);
+    player_set_health(player, (int)player_record->health);
+    for (j = 0; j < player_record->n_objects; j++)
+      player_add_object_to_backpack(player, *(long *)world_record(image, ID_TABLE, player_record->first_object + j));
+    if (player_record->team != NO_ID)
+      player_set_team(player, player_record->team);
+    if (game_add_player(game, player) == ERROR)
+    {
+      player_destroy(player);
+      return ERROR;
+    }
+  }
+
+  for (i = 0; i < tables[CHARACTER_TABLE].count; i++)
+  {
+    character_record = (Character_record *)world_record(image, CHARACTER_TABLE, i);
+    if (!world_string(image, character_record->name) || !world_string(image, character_record->gdesc) || !world_string(image, character_record->dead_gdesc))
+      return ERROR;
+    if (!(character = character_create_in_arena(game_get_arena(game), character_record->id)))
+      return ERROR;
+    character_set_name(character, world_string(image, character_record->name));
+    character_set_gdesc(character, world_string(image, character_record->gdesc));
+    character_set_dead_gdesc(character, world_string(image, character_record->dead_gdesc));
+    character_set_location(character, character_record->location);
+    character_set_health(character, (int)character_record->health);
+    character_set_friendly(character, (Bool)character_record->friendly);
+    character_set_following(character, character_record->following);
+    for (j = 0; j < character_record->n_messages; j++)
+    {
+      if (character_add_message(character, world_table_string(image, character_record->first_message + j)) == ERROR)
+      {
+        character_destroy(character);
+        return ERROR;
+      }
+    }
+    if (game_add_character(game, character) == ERROR)
+    {
+      character_destroy(character);
+      return ERROR;
+    }
+  }
+
+  for (i = 0; i < tables[LINK_TABLE].count; i++)
+  {
+    link_record = (Link_record *)world_record(image, LINK_TABLE, i);
+    if (!world_string(image, link_record->name) || !(link = link_create_in_arena(game_get_arena(game), link_record->id)))
+      return ERROR;
+    link_set_name(link, world_string(image, link_record->name));
+    link_set_origin_id(link, link_record->origin);
+    link_set_destination_id(link, link_record->destination);
+    link_set_direction(link, (Direction)link_record->direction);
+    link_set_is_open(link, (Bool)link_record->open);
+    if (game_add_link(game, link) == ERROR)
+    {
+      link_destroy(link);
+      return ERROR;
+    }
+  }
+
+  for (i = 0; i < tables[CINEMATIC_TABLE].count; i++)
+  {
+    cinematic_record = (Cinematic_record *)world_record(image, CINEMATIC_TABLE, i);
+    if (cinematic_record->cinematic < 0 || cinematic_record->cinematic >= N_CINEMATICS || !world_string(image, cinematic_record->text))
+      return ERROR;
+    cinematics_text_add_line(game_get_cinematic_text_in_pos(game, (int)cinematic_record->cinematic), world_string(image, cinematic_record->text));
+  }
+
+  for (i = 0; i < tables[MISSION_TABLE].count; i++)
+  {
+    mission_record = (Mission_record *)world_record(image, MISSION_TABLE, i);
+    if (!(mission = mission_create_in_arena(game_get_arena(game))))
+      return ERROR;
+    mission_set_code(mission, (Mission_Code)mission_record->code);
+    mission_set_current_step(mission, (int)mission_record->current_step);
+    mission_set_next_objective(mission, (int)mission_record->next_objective);
+    mission_set_next_dialogue(mission, (int)mission_record->next_dialogue);
+    for (j = 0; j < mission_record->n_objectives; j++)
+    {
+      if (mission_add_objective(mission, world_table_string(image, mission_record->first_objective + j)) == ERROR)
+      {
+        mission_destroy(mission);
+        return ERROR;
+      }
+    }
+    for (j = 0; j < mission_record->n_dialogues; j++)
+    {
+      if (mission_add_dialogue(mission, world_table_string(image, mission_record->first_dialogue + j)) == ERROR)
+      {
+        mission_destroy(mission);
+        return ERROR;
+      }
+    }
+    if (game_add_mission(game, mission) == ERROR)
+    {
+      mission_destroy(mission);
+      return ERROR;
+    }
+  }
+
+  /*Objects and characters are placed in the same order as when loading a data file, so the spaces list them the same way*/
+  for (i = 0; i < game_get_n_objects(game); i++)
+  {
+    object_record = (Object_record *)world_record(image, OBJECT_TABLE, i);
+    space_add_objectId(game_get_space(game, object_record->location), object_record->id);
+  }
+  for (i = 0; i < game_get_n_characters(game); i++)
+  {
+    character = game_get_character_in_pos(game, i);
+    space_add_character(game_get_space(game, character_get_location(character)), character_get_id(character));
+  }
+
+  game_set_current_cinematic(game, (Cinematics)image->header->current_cinematic);
+
+  return OK;
+}
@@ -0,0 +1,59 @@
+/**
+ * @brief It implements the world a game starts from, loaded once for every game created from it
+ *
+ * @file world_template.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "world_template.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief World before anybody plays it
+ * @author agent
+ */
+struct _World_template
+{
+  Game *world; /*!<Game in the initial state, it is only copied*/
+};
+
+World_template *world_template_create(char *filename)
+{
+  World_template *world = NULL;
+
+  if (!filename || !(world = (World_template *)malloc(sizeof(World_template))))
+    return NULL;
+
+  world->world = NULL;
+  if (game_create_from_file(&world->world, filename) == ERROR)
+  {
+    if (world->world)
+      game_destroy(world->world);
+    free(world);
+    return NULL;
+  }
+
+  return world;
+}
+
+void world_template_destroy(World_template *world)
+{
+  if (!world)
+    return;
+
+  game_destroy(world->world);
+  free(world);
+}
+
+Status world_template_new_game(World_template *world, Game **game)
+{
+  if (!world || !game)
+    return ERROR;
+
+  return game_create_copy(game, world->world);
+}
@@ -0,0 +1,55 @@
+/**
+ * @brief It compiles a data file of the game into a world image
+ *
+ * @file worldc.c
+ * @author agent
+ * @version 0
+ * @date 18-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "game.h"
+#include "world.h"
+#include "string_pool.h"
+
+/**
+ * @brief main function of the world compiler, it loads the data file and writes its world as an image
+ * @author agent
+ *
+ * The image can be given to the game instead of the data file.
+ * @param argc number of arguments
+ * @param argv the name of the data file and the name of the image
+ * @return int: 1 if an error occurs and 0 if no errors occur
+ */
+int main(int argc, char *argv[])
+{
+  Game *game = NULL;
+
+  if (argc < 3)
+  {
+    fprintf(stderr, "Use: %s <game_data_file> <world_image>\n", argv[0]);
+    return 1;
+  }
+
+  if (game_create_from_file(&game, argv[1]) == ERROR)
+  {
+    fprintf(stderr, "Error while loading the data file: |%s|\n", argv[1]);
+    if (game)
+      game_destroy(game);
+    return 1;
+  }
+
+  if (world_compile(game, argv[2]) == ERROR)
+  {
+    fprintf(stderr, "Error while writing the world image: |%s|\n", argv[2]);
+    game_destroy(game);
+    return 1;
+  }
+
+  game_destroy(game);
+  string_pool_release();
+  return 0;
+}